@@ -12,6 +12,9 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BaseAbilitySystemComponent)
 
+DECLARE_CYCLE_STAT(TEXT("Bulk Effect Application"), STAT_GASGlobal_BulkApply, STATGROUP_GASGlobal);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bulk Effect Targets"), STAT_GASGlobal_BulkTargets, STATGROUP_GASGlobal);
+
 UBaseAbilitySystemComponent::UBaseAbilitySystemComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -153,13 +156,13 @@ void UBaseAbilitySystemComponent::SetAbilityInputTagPressed(const FGameplayTag&
 {
 	if (!InputTag.IsValid()) return;
 
-	for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* SpecHandles = InputTagToSpecHandles.Find(InputTag);
+	if (!SpecHandles) return;
+
+	for (const FGameplayAbilitySpecHandle& SpecHandle : *SpecHandles)
 	{
-		if (AbilitySpec.Ability && (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag)))
-		{
-			InputPressedSpecHandlesList.AddUnique(AbilitySpec.Handle);
-			InputHeldSpecHandlesList.AddUnique(AbilitySpec.Handle);
-		}
+		InputPressedSpecHandlesList.AddUnique(SpecHandle);
+		InputHeldSpecHandlesList.AddUnique(SpecHandle);
 	}
 }
 
@@ -168,16 +171,80 @@ void UBaseAbilitySystemComponent::SetAbilityInputTagReleased(const FGameplayTag&
 {
 	if (!InputTag.IsValid()) return;
 
-	for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items)
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* SpecHandles = InputTagToSpecHandles.Find(InputTag);
+	if (!SpecHandles) return;
+
+	for (const FGameplayAbilitySpecHandle& SpecHandle : *SpecHandles)
 	{
-		if (AbilitySpec.Ability && (AbilitySpec.GetDynamicSpecSourceTags().HasTagExact(InputTag)))
-		{
-			InputReleasedSpecHandlesList.AddUnique(AbilitySpec.Handle);
-			InputHeldSpecHandlesList.Remove(AbilitySpec.Handle);
-		}
+		InputReleasedSpecHandlesList.AddUnique(SpecHandle);
+		InputHeldSpecHandlesList.Remove(SpecHandle);
 	}
 }
 
+void UBaseAbilitySystemComponent::NotifyAbilityInputTagsChanged(FGameplayAbilitySpec& Spec)
+{
+	RemoveFromInputTagIndex(Spec.Handle);
+	AddToInputTagIndex(Spec);
+	MarkAbilitySpecDirty(Spec);
+}
+
+void UBaseAbilitySystemComponent::AddToInputTagIndex(const FGameplayAbilitySpec& Spec)
+{
+	if (!Spec.Ability) return;
+
+	const FGameplayTagContainer& InputTags = Spec.GetDynamicSpecSourceTags();
+	if (InputTags.IsEmpty()) return;
+
+	for (const FGameplayTag& InputTag : InputTags) InputTagToSpecHandles.FindOrAdd(InputTag).AddUnique(Spec.Handle);
+	IndexedSpecInputTags.Add(Spec.Handle, InputTags);
+}
+
+void UBaseAbilitySystemComponent::RemoveFromInputTagIndex(const FGameplayAbilitySpecHandle Handle)
+{
+	FGameplayTagContainer InputTags;
+	if (!IndexedSpecInputTags.RemoveAndCopyValue(Handle, InputTags)) return;
+
+	for (const FGameplayTag& InputTag : InputTags)
+	{
+		TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>* SpecHandles = InputTagToSpecHandles.Find(InputTag);
+		if (!SpecHandles) continue;
+
+		SpecHandles->RemoveSingleSwap(Handle);
+		if (SpecHandles->IsEmpty()) InputTagToSpecHandles.Remove(InputTag);
+	}
+}
+
+void UBaseAbilitySystemComponent::RebuildInputTagIndex()
+{
+	InputTagToSpecHandles.Reset();
+	IndexedSpecInputTags.Reset();
+
+	for (const FGameplayAbilitySpec& AbilitySpec : ActivatableAbilities.Items) AddToInputTagIndex(AbilitySpec);
+}
+
+void UBaseAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	Super::OnGiveAbility(AbilitySpec);
+
+	RemoveFromInputTagIndex(AbilitySpec.Handle);
+	AddToInputTagIndex(AbilitySpec);
+}
+
+void UBaseAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	RemoveFromInputTagIndex(AbilitySpec.Handle);
+
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
+void UBaseAbilitySystemComponent::OnRep_ActivateAbilities()
+{
+	Super::OnRep_ActivateAbilities();
+
+	// Dynamic tags of existing specs can change through replication without a give/remove, resync from the replicated list
+	RebuildInputTagIndex();
+}
+
 // This function processes the ability input.
 void UBaseAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGamePaused)
 {
@@ -188,12 +255,12 @@ void UBaseAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGam
 		return;
 	}
 	// Process all abilities that are held, pressed, and released.
-	TSet<FGameplayAbilitySpecHandle> AbilitiesToActivate;
-	AbilitiesToActivate.Append(ProcessHeldAbilities());
-	AbilitiesToActivate.Append(ProcessPressedAbilities());
+	AbilitiesToActivateScratch.Reset();
+	ProcessHeldAbilities(AbilitiesToActivateScratch);
+	ProcessPressedAbilities(AbilitiesToActivateScratch);
 
 	// Try to activate all the abilities that are from presses and holds.
-	for (const FGameplayAbilitySpecHandle& AbilitySpecHandle : AbilitiesToActivate) { TryActivateAbility(AbilitySpecHandle); }
+	for (const FGameplayAbilitySpecHandle& AbilitySpecHandle : AbilitiesToActivateScratch) { TryActivateAbility(AbilitySpecHandle); }
 
 	ProcessReleasedAbilities();
 	// Clear the cached ability handles.
@@ -202,10 +269,8 @@ void UBaseAbilitySystemComponent::ProcessAbilityInput(float DeltaTime, bool bGam
 }
 
 // This function processes all abilities that are held.
-TSet<FGameplayAbilitySpecHandle> UBaseAbilitySystemComponent::ProcessHeldAbilities()
+void UBaseAbilitySystemComponent::ProcessHeldAbilities(TSet<FGameplayAbilitySpecHandle>& OutAbilitiesToActivate)
 {
-	TSet<FGameplayAbilitySpecHandle> AbilitiesToActivate;
-
 	// Process all abilities that activate when the input is held.
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputHeldSpecHandlesList)
 	{
@@ -219,18 +284,14 @@ TSet<FGameplayAbilitySpecHandle> UBaseAbilitySystemComponent::ProcessHeldAbiliti
 		if (!AbilitySpec->IsActive())
 		{
 			const UBaseGameplayAbility* BaseAbilityCDO = Cast<UBaseGameplayAbility>(AbilitySpec->Ability);
-			if (BaseAbilityCDO && BaseAbilityCDO->GetActivationPolicy() == EAbilityActivationPolicy::WhileInputActive) AbilitiesToActivate.Add(AbilitySpec->Handle);
+			if (BaseAbilityCDO && BaseAbilityCDO->GetActivationPolicy() == EAbilityActivationPolicy::WhileInputActive) OutAbilitiesToActivate.Add(AbilitySpec->Handle);
 		}
 	}
-
-	return AbilitiesToActivate;
 }
 
 // This function processes all abilities that had their input pressed this frame.
-TSet<FGameplayAbilitySpecHandle> UBaseAbilitySystemComponent::ProcessPressedAbilities()
+void UBaseAbilitySystemComponent::ProcessPressedAbilities(TSet<FGameplayAbilitySpecHandle>& OutAbilitiesToActivate)
 {
-	TSet<FGameplayAbilitySpecHandle> AbilitiesToActivate;
-
 	// Process all abilities that had their input pressed this frame.
 	for (const FGameplayAbilitySpecHandle& SpecHandle : InputPressedSpecHandlesList)
 	{
@@ -249,11 +310,9 @@ TSet<FGameplayAbilitySpecHandle> UBaseAbilitySystemComponent::ProcessPressedAbil
 			// If the ability is not active, check if it should be activated.
 			const UBaseGameplayAbility* BaseAbilityCDO = Cast<UBaseGameplayAbility>(AbilitySpec->Ability);
 
-			if (BaseAbilityCDO && BaseAbilityCDO->GetActivationPolicy() == EAbilityActivationPolicy::OnInputTriggered) AbilitiesToActivate.Add(AbilitySpec->Handle);
+			if (BaseAbilityCDO && BaseAbilityCDO->GetActivationPolicy() == EAbilityActivationPolicy::OnInputTriggered) OutAbilitiesToActivate.Add(AbilitySpec->Handle);
 		}
 	}
-
-	return AbilitiesToActivate;
 }
 
 // This function processes all abilities that had their input released this frame.
@@ -400,6 +459,54 @@ void UBaseAbilitySystemComponent::RemoveDynamicTagGameplayEffect(
 	RemoveActiveEffects(Query);
 }
 
+TArray<FActiveGameplayEffectHandle> UBaseAbilitySystemComponent::ApplyGameplayEffectSpecToTargets(
+	const FGameplayEffectSpec& Spec, const TConstArrayView<UAbilitySystemComponent*> Targets,
+	FBulkGameplayEffectStats* OutStats)
+{
+	SCOPE_CYCLE_COUNTER(STAT_GASGlobal_BulkApply);
+	INC_DWORD_STAT_BY(STAT_GASGlobal_BulkTargets, Targets.Num());
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FActiveGameplayEffectHandle> Handles;
+	Handles.Reserve(Targets.Num());
+	int32 NumApplied = 0;
+	for (UAbilitySystemComponent* Target : Targets)
+	{
+		FActiveGameplayEffectHandle& Handle = Handles.AddDefaulted_GetRef();
+		if (!Target) continue;
+
+		Handle = ApplyGameplayEffectSpecToTarget(Spec, Target, ScopedPredictionKey);
+		if (Handle.WasSuccessfullyApplied()) ++NumApplied;
+	}
+
+	if (OutStats)
+	{
+		OutStats->NumTargets += Targets.Num();
+		OutStats->NumApplied += NumApplied;
+		OutStats->ApplySeconds += FPlatformTime::Seconds() - StartTime;
+	}
+	return Handles;
+}
+
+TArray<FActiveGameplayEffectHandle> UBaseAbilitySystemComponent::ApplyGameplayEffectToTargets(
+	const TSubclassOf<UGameplayEffect> GameplayEffectClass, const float Level,
+	const TConstArrayView<UAbilitySystemComponent*> Targets, FGameplayEffectContextHandle Context,
+	FBulkGameplayEffectStats* OutStats)
+{
+	if (!GameplayEffectClass || Targets.IsEmpty()) return TArray<FActiveGameplayEffectHandle>();
+
+	const double StartTime = FPlatformTime::Seconds();
+	if (!Context.IsValid()) Context = MakeEffectContext();
+
+	// Source tags and snapshotted source attributes (e.g. DamageExecution's BaseDamage) are captured here, once
+	const FGameplayEffectSpecHandle SpecHandle = MakeOutgoingSpec(GameplayEffectClass, Level, Context);
+	if (OutStats) OutStats->SpecSetupSeconds += FPlatformTime::Seconds() - StartTime;
+	if (!SpecHandle.IsValid()) return TArray<FActiveGameplayEffectHandle>();
+
+	return ApplyGameplayEffectSpecToTargets(*SpecHandle.Data, Targets, OutStats);
+}
+
 //
 void UBaseAbilitySystemComponent::GetAbilityTargetData(const FGameplayAbilitySpecHandle AbilityHandle,
                                                        const FGameplayAbilityActivationInfo& ActivationInfo,
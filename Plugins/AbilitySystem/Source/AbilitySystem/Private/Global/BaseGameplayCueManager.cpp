@@ -3,7 +3,13 @@
 #include "AbilitySystemGlobals.h"
 #include "GameplayTagsManager.h"
 #include "GameplayCueSet.h"
+#include "GameplayEffect.h"
+#include "Abilities/GameplayAbility.h"
 #include "Engine/AssetManager.h"
+#include "Engine/DataAsset.h"
+#include "Experience/ExperienceManagerComponent.h"
+#include "Experience/DataAsset/ExperienceDefinition_DA.h"
+#include "UObject/UnrealType.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BaseGameplayCueManager)
 
 enum class EEditorLoadMode
@@ -17,7 +23,11 @@ enum class EEditorLoadMode
 	PreloadAsCuesAreReferenced_GameOnly,
 
 	// Async loads as cue tag are registered
-	PreloadAsCuesAreReferenced
+	PreloadAsCuesAreReferenced,
+
+	// Async loads at low priority the cues referenced by the abilities and effects of the experience, as soon as its
+	// bundles are loaded and before gameplay begins. Cues referenced later are still loaded as they are referenced.
+	PreloadFromExperience
 };
 
 // Console variables for controlling how gameplay cues are loaded
@@ -28,7 +38,25 @@ namespace GameplayCueManagerCvars
 		TEXT("Shows all assets that were loaded via BaseGameplayCueManager and are currently in memory."),
 		FConsoleCommandWithArgsDelegate::CreateStatic(UBaseGameplayCueManager::DumpGameplayCues));
 
-	static EEditorLoadMode LoadMode = EEditorLoadMode::LoadUpfront;
+	static FAutoConsoleCommand CVarDumpGameplayCueCoverage(
+		TEXT("GAS.DumpGameplayCueCoverage"),
+		TEXT("Shows how many of the cues predicted from the experience were loaded before gameplay began, and which cues were loaded late."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(UBaseGameplayCueManager::DumpGameplayCueCoverage));
+
+	static int32 LoadModeSetting = static_cast<int32>(EEditorLoadMode::LoadUpfront);
+	static FAutoConsoleVariableRef CVarLoadMode(
+		TEXT("GAS.GameplayCueLoadMode"),
+		LoadModeSetting,
+		TEXT("How gameplay cues are loaded. 0: everything up front, 1: as they are referenced (game only), 2: as they are referenced, 3: predicted from the experience"),
+		ECVF_ReadOnly);
+
+	static EEditorLoadMode GetLoadMode()
+	{
+		return static_cast<EEditorLoadMode>(FMath::Clamp(LoadModeSetting, 0, static_cast<int32>(EEditorLoadMode::PreloadFromExperience)));
+	}
+
+	// Predicted cues load behind the cues referenced by loaded content and the ones requested by a cue firing
+	static constexpr TAsyncLoadPriority PredictedCueLoadPriority = FStreamableManager::DefaultAsyncLoadPriority - 1;
 }
 
 constexpr bool bPreloadEvenInEditor = true;
@@ -73,7 +101,7 @@ void UBaseGameplayCueManager::OnCreated()
 // the current map.
 bool UBaseGameplayCueManager::ShouldAsyncLoadRuntimeObjectLibraries() const
 {
-	switch (GameplayCueManagerCvars::LoadMode)
+	switch (GameplayCueManagerCvars::GetLoadMode())
 	{
 	case EEditorLoadMode::LoadUpfront:
 		return true;
@@ -86,6 +114,7 @@ bool UBaseGameplayCueManager::ShouldAsyncLoadRuntimeObjectLibraries() const
 #endif
 		break;
 	case EEditorLoadMode::PreloadAsCuesAreReferenced:
+	case EEditorLoadMode::PreloadFromExperience:
 		break;
 	}
 
@@ -332,7 +361,7 @@ void UBaseGameplayCueManager::ProcessLoadedTags()
 
 void UBaseGameplayCueManager::ProcessTagToPreload(const FGameplayTag& Tag, UObject* OwningObject)
 {
-	switch (GameplayCueManagerCvars::LoadMode)
+	switch (GameplayCueManagerCvars::GetLoadMode())
 	{
 	case EEditorLoadMode::LoadUpfront:
 		return;
@@ -345,6 +374,7 @@ void UBaseGameplayCueManager::ProcessTagToPreload(const FGameplayTag& Tag, UObje
 #endif
 		break;
 	case EEditorLoadMode::PreloadAsCuesAreReferenced:
+	case EEditorLoadMode::PreloadFromExperience:
 		break;
 	}
 
@@ -411,7 +441,7 @@ void UBaseGameplayCueManager::OnPreloadCueComplete(FSoftObjectPath Path, TWeakOb
 *In summary, the RegisterPreloadedCue function is used to register preloaded gameplay cues and their references. 
 *	It distinguishes between cues that are always loaded and cues that are preloaded based on the OwningObject parameter
 */
-void UBaseGameplayCueManager::RegisterPreloadedCue(UClass* LoadedGameplayCueClass, UObject* OwningObject)
+void UBaseGameplayCueManager::RegisterPreloadedCue(UClass* LoadedGameplayCueClass, const UObject* OwningObject)
 {
 	check(LoadedGameplayCueClass);
 
@@ -471,7 +501,7 @@ void UBaseGameplayCueManager::HandlePostLoadMap(UWorld* NewWorld)
  * Updates the delay load delegate listeners based on the current load mode.
  * This function is responsible for resetting all listeners and adding new listeners based on the load mode configuration.
  * It removes existing listeners for gameplay tag loaded events, post garbage collection events, and post load map events.
- * Then, based on the value of GameplayCueManagerCvars::LoadMode, it adds new listeners to the respective delegates.
+ * Then, based on the value of GameplayCueManagerCvars::GetLoadMode(), it adds new listeners to the respective delegates.
  * The listeners are added to the current instance of the UBaseGameplayCueManager class and the corresponding member functions are specified as the callback functions.
  *
  * @note This function is called when a gameplay tag is loaded and is used to update the listeners accordingly.
@@ -482,8 +512,10 @@ void UBaseGameplayCueManager::UpdateDelayLoadDelegateListeners()
 	UGameplayTagsManager::Get().OnGameplayTagLoadedDelegate.RemoveAll(this);
 	FCoreUObjectDelegates::GetPostGarbageCollect().RemoveAll(this);
 	FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
+	UExperienceManagerComponent::OnAnyExperienceBundlesLoaded.RemoveAll(this);
+	UExperienceManagerComponent::OnAnyExperienceLoaded.RemoveAll(this);
 
-	switch (GameplayCueManagerCvars::LoadMode)
+	switch (GameplayCueManagerCvars::GetLoadMode())
 	{
 	case EEditorLoadMode::LoadUpfront:
 		return;
@@ -496,6 +528,7 @@ void UBaseGameplayCueManager::UpdateDelayLoadDelegateListeners()
 #endif
 		break;
 	case EEditorLoadMode::PreloadAsCuesAreReferenced:
+	case EEditorLoadMode::PreloadFromExperience:
 		break;
 	}
 
@@ -503,9 +536,293 @@ void UBaseGameplayCueManager::UpdateDelayLoadDelegateListeners()
 	UGameplayTagsManager::Get().OnGameplayTagLoadedDelegate.AddUObject(this, &ThisClass::OnGameplayTagLoaded);
 	FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &ThisClass::HandlePostGarbageCollect);
 	FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &ThisClass::HandlePostLoadMap);
+
+	if (GameplayCueManagerCvars::GetLoadMode() == EEditorLoadMode::PreloadFromExperience)
+	{
+		UExperienceManagerComponent::OnAnyExperienceBundlesLoaded.AddUObject(this, &ThisClass::HandleExperienceBundlesLoaded);
+		UExperienceManagerComponent::OnAnyExperienceLoaded.AddUObject(this, &ThisClass::HandleExperienceLoaded);
+	}
 }
 
 bool UBaseGameplayCueManager::ShouldDelayLoadGameplayCues() const
 {
 	return !IsRunningDedicatedServer();
 }
+
+void UBaseGameplayCueManager::HandleExperienceBundlesLoaded(const UExperienceDefinition_DA* Experience)
+{
+	if (!Experience || !ShouldDelayLoadGameplayCues() || !RuntimeGameplayCueObjectLibrary.CueSet)
+	{
+		return;
+	}
+
+	// Every experience manager of a match loads the same experience (listen server and clients in PIE), and the
+	// ones that finish after gameplay began must not count as a new match. Its cues are only predicted once
+	if (PredictingExperiences.Contains(Experience))
+	{
+		return;
+	}
+
+	// Gameplay began with another experience, so this is a new match: let go of what was predicted for the previous one
+	if (bGameplayStarted)
+	{
+		ReleasePredictedCues();
+		bGameplayStarted = false;
+	}
+
+	TSet<FGameplayTag> CueTags;
+	CollectReferencedCueTags(Experience, CueTags);
+
+	PredictedCueTags.Append(CueTags);
+	PredictingExperiences.Add(Experience);
+
+	TArray<FSoftObjectPath> PathsToLoad;
+	for (const FGameplayTag& CueTag : CueTags)
+	{
+		const int32 DataIdx = RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueDataMap.FindChecked(CueTag);
+		const FSoftObjectPath& CuePath = RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueData[DataIdx].GameplayCueNotifyObj;
+
+		if (UClass* LoadedGameplayCueClass = FindObject<UClass>(nullptr, *CuePath.ToString()))
+		{
+			RegisterPreloadedCue(LoadedGameplayCueClass, Experience);
+		}
+		else
+		{
+			PathsToLoad.Add(CuePath);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UBaseGameplayCueManager: %d cues predicted from experience %s, %d to load"),
+	       CueTags.Num(), *GetNameSafe(Experience), PathsToLoad.Num());
+
+	if (PathsToLoad.Num() > 0)
+	{
+		const TWeakObjectPtr<const UExperienceDefinition_DA> WeakExperience = Experience;
+
+		StreamableManager.RequestAsyncLoad(
+			PathsToLoad,
+			FStreamableDelegate::CreateUObject(
+				this,
+				&ThisClass::OnPredictedCuesLoaded,
+				PathsToLoad,
+				WeakExperience
+				),
+			GameplayCueManagerCvars::PredictedCueLoadPriority,
+			false,
+			false,
+			TEXT("GameplayCueManager_Predicted")
+			);
+	}
+}
+
+void UBaseGameplayCueManager::OnPredictedCuesLoaded(TArray<FSoftObjectPath> Paths,
+                                                    TWeakObjectPtr<const UExperienceDefinition_DA> WeakExperience)
+{
+	// Released (new match) before the load finished
+	const UExperienceDefinition_DA* Experience = WeakExperience.Get();
+	if (!Experience || !PredictingExperiences.Contains(Experience))
+	{
+		return;
+	}
+
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		if (UClass* LoadedGameplayCueClass = Cast<UClass>(Path.ResolveObject()))
+		{
+			RegisterPreloadedCue(LoadedGameplayCueClass, Experience);
+		}
+	}
+}
+
+void UBaseGameplayCueManager::HandleExperienceLoaded(const UExperienceDefinition_DA* Experience)
+{
+	// Several experience managers can finish for the same match (listen server and clients in PIE), the first one starts gameplay
+	if (bGameplayStarted || !ShouldDelayLoadGameplayCues() || !RuntimeGameplayCueObjectLibrary.CueSet)
+	{
+		return;
+	}
+
+	bGameplayStarted = true;
+
+	CuesLoadedAtGameplayStart.Reset();
+	for (const FGameplayCueNotifyData& CueData : RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueData)
+	{
+		if (CueData.LoadedGameplayCueClass || CueData.GameplayCueNotifyObj.ResolveObject())
+		{
+			CuesLoadedAtGameplayStart.Add(CueData.GameplayCueTag);
+		}
+	}
+
+	int32 NumPredictedInTime = 0;
+	for (const FGameplayTag& CueTag : PredictedCueTags)
+	{
+		NumPredictedInTime += CuesLoadedAtGameplayStart.Contains(CueTag) ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("UBaseGameplayCueManager: %d/%d predicted cues loaded before gameplay began (%s)"),
+	       NumPredictedInTime, PredictedCueTags.Num(), *GetNameSafe(Experience));
+}
+
+void UBaseGameplayCueManager::ReleasePredictedCues()
+{
+	for (auto CueIt = PreloadedCues.CreateIterator(); CueIt; ++CueIt)
+	{
+		TSet<FObjectKey>& ReferencerSet = PreloadedCueReferencers.FindChecked(*CueIt);
+		for (const FObjectKey& Experience : PredictingExperiences)
+		{
+			ReferencerSet.Remove(Experience);
+		}
+
+		if (ReferencerSet.Num() == 0)
+		{
+			if (RuntimeGameplayCueObjectLibrary.CueSet)
+			{
+				RuntimeGameplayCueObjectLibrary.CueSet->RemoveLoadedClass(*CueIt);
+			}
+
+			PreloadedCueReferencers.Remove(*CueIt);
+			CueIt.RemoveCurrent();
+		}
+	}
+
+	PredictedCueTags.Reset();
+	PredictingExperiences.Reset();
+	CuesLoadedAtGameplayStart.Reset();
+}
+
+/*
+* Walks the experience the way it grants things: data assets (action sets, pawn data, ability sets), their instanced
+* subobjects (game feature actions) and the gameplay ability / effect classes they reference, whether hard or soft
+* (soft references are only followed if the experience bundles already loaded them). Every gameplay tag found along the
+* way that has a cue notify is collected, this covers the cues of gameplay effects as well as cue tags set on abilities.
+* Meshes, widgets, actors and anything else are not followed.
+*/
+void UBaseGameplayCueManager::CollectReferencedCueTags(const UObject* Root, TSet<FGameplayTag>& OutCueTags) const
+{
+	check(RuntimeGameplayCueObjectLibrary.CueSet);
+	const TMap<FGameplayTag, int32>& CueDataMap = RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueDataMap;
+
+	TSet<const UObject*> Visited;
+	TArray<const UObject*> ToVisit;
+	Visited.Add(Root);
+	ToVisit.Add(Root);
+
+	auto TryFollow = [&Visited, &ToVisit](const UObject* Object, const UObject* Referencer)
+	{
+		if (!Object)
+		{
+			return;
+		}
+
+		if (const UClass* Class = Cast<UClass>(Object))
+		{
+			if (!Class->IsChildOf(UGameplayAbility::StaticClass()) && !Class->IsChildOf(UGameplayEffect::StaticClass()))
+			{
+				return;
+			}
+
+			Object = Class->GetDefaultObject();
+		}
+		else if (!Object->IsA<UDataAsset>() && !Object->IsIn(Referencer)
+		         && !Object->IsA<UGameplayAbility>() && !Object->IsA<UGameplayEffect>())
+		{
+			return;
+		}
+
+		bool bAlreadyVisited = false;
+		Visited.Add(Object, &bAlreadyVisited);
+		if (!bAlreadyVisited)
+		{
+			ToVisit.Add(Object);
+		}
+	};
+
+	auto AddCueTag = [&CueDataMap, &OutCueTags](const FGameplayTag& Tag)
+	{
+		if (CueDataMap.Contains(Tag))
+		{
+			OutCueTags.Add(Tag);
+		}
+	};
+
+	while (ToVisit.Num() > 0)
+	{
+		const UObject* Object = ToVisit.Pop(EAllowShrinking::No);
+
+		for (TPropertyValueIterator<FProperty> It(Object->GetClass(), Object); It; ++It)
+		{
+			const FProperty* Property = It.Key();
+			const void* Value = It.Value();
+
+			if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+			{
+				if (StructProperty->Struct == FGameplayTag::StaticStruct())
+				{
+					AddCueTag(*static_cast<const FGameplayTag*>(Value));
+				}
+				else if (StructProperty->Struct == FGameplayTagContainer::StaticStruct())
+				{
+					for (const FGameplayTag& Tag : *static_cast<const FGameplayTagContainer*>(Value))
+					{
+						AddCueTag(Tag);
+					}
+
+					// The container also stores the parents of its tags, those aren't referenced cues
+					It.SkipRecursiveProperty();
+				}
+			}
+			else if (const FObjectPropertyBase* ObjectProperty = CastField<FObjectPropertyBase>(Property))
+			{
+				// Soft references resolve to null unless they're already loaded
+				TryFollow(ObjectProperty->GetObjectPropertyValue(Value), Object);
+			}
+		}
+	}
+}
+
+void UBaseGameplayCueManager::DumpGameplayCueCoverage(const TArray<FString>& Args)
+{
+	const UBaseGameplayCueManager* Gcm = Get();
+	if (!Gcm || !Gcm->RuntimeGameplayCueObjectLibrary.CueSet)
+	{
+		UE_LOG(LogTemp, Error, TEXT("DumpGameplayCueCoverage failed. No UBaseGameplayCueManager or runtime cue set found."));
+		return;
+	}
+
+	if (!Gcm->bGameplayStarted)
+	{
+		UE_LOG(LogTemp, Log, TEXT("DumpGameplayCueCoverage: gameplay hasn't begun yet (requires GAS.GameplayCueLoadMode 3)."));
+		return;
+	}
+
+	int32 NumPredictedInTime = 0;
+	for (const FGameplayTag& CueTag : Gcm->PredictedCueTags)
+	{
+		NumPredictedInTime += Gcm->CuesLoadedAtGameplayStart.Contains(CueTag) ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("=========== Gameplay Cues loaded after gameplay began ==========="));
+	int32 NumLoaded = 0;
+	int32 NumLoadedLate = 0;
+	for (const FGameplayCueNotifyData& CueData : Gcm->RuntimeGameplayCueObjectLibrary.CueSet->GameplayCueData)
+	{
+		if (!CueData.LoadedGameplayCueClass && !CueData.GameplayCueNotifyObj.ResolveObject())
+		{
+			continue;
+		}
+
+		NumLoaded++;
+		if (!Gcm->CuesLoadedAtGameplayStart.Contains(CueData.GameplayCueTag))
+		{
+			NumLoadedLate++;
+			UE_LOG(LogTemp, Log, TEXT("  %s%s"), *CueData.GameplayCueTag.ToString(),
+			       Gcm->PredictedCueTags.Contains(CueData.GameplayCueTag) ? TEXT(" (predicted, load didn't finish in time)") : TEXT(""));
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("=========== Gameplay Cue coverage summary ==========="));
+	UE_LOG(LogTemp, Log, TEXT("  ... %d cues predicted from the experience, %d loaded before gameplay began"),
+	       Gcm->PredictedCueTags.Num(), NumPredictedInTime);
+	UE_LOG(LogTemp, Log, TEXT("  ... %d cues in memory, %d of them loaded late (%.1f%% coverage)"),
+	       NumLoaded, NumLoadedLate, NumLoaded > 0 ? 100.0f * (NumLoaded - NumLoadedLate) / NumLoaded : 100.0f);
+}
@@ -4,16 +4,29 @@
 
 //#include UE_INLINE_GENERATED_CPP_BY_NAME(FGlobalAppliedEffectList)
 
-void FGlobalAppliedEffectList::AddToAsc(const TSubclassOf<UGameplayEffect>& Effect, UBaseAbilitySystemComponent* Asc)
+void FGlobalAppliedEffectList::AddToAsc(const TSubclassOf<UGameplayEffect>& Effect, UBaseAbilitySystemComponent* Asc,
+                                       const FGameplayEffectSpec* SharedSpec)
 {
 	if (Handles.Find(Asc))
 	{
 		RemoveFromAsc(Asc);
 	}
 
-	const UGameplayEffect* GameplayEffectCDO = Effect->GetDefaultObject<UGameplayEffect>();
-	const FActiveGameplayEffectHandle GameplayEffectHandle = Asc->ApplyGameplayEffectToSelf(
-		GameplayEffectCDO, /*Level=*/ 1, Asc->MakeEffectContext());
+	FActiveGameplayEffectHandle GameplayEffectHandle;
+	if (SharedSpec)
+	{
+		// Only building the spec is shared: every ASC is still its own instigator and source, as without a shared spec
+		FGameplayEffectSpec Spec(*SharedSpec);
+		Spec.SetContext(Asc->MakeEffectContext(), /*bSkipRecaptureSourceActorTags=*/ true);
+		Spec.CapturedSourceTags.GetActorTags().Reset();
+		Asc->GetOwnedGameplayTags(Spec.CapturedSourceTags.GetActorTags());
+		GameplayEffectHandle = Asc->ApplyGameplayEffectSpecToSelf(Spec);
+	}
+	else
+	{
+		const UGameplayEffect* GameplayEffectCDO = Effect->GetDefaultObject<UGameplayEffect>();
+		GameplayEffectHandle = Asc->ApplyGameplayEffectToSelf(GameplayEffectCDO, /*Level=*/ 1, Asc->MakeEffectContext());
+	}
 	Handles.Add(Asc, GameplayEffectHandle);
 }
 
@@ -1,5 +1,6 @@
 #include "Global/GlobalGasWorldSubsystem.h"
 
+#include "AbilitySystemGlobals.h"
 #include "Global/GlobalAppliedAbilityList.h"
 #include "Global/GlobalAppliedEffectList.h"
 #include"Component/BaseAbilitySystemComponent.h"
@@ -7,6 +8,28 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(GlobalGasWorldSubsystem)
 
+DECLARE_CYCLE_STAT(TEXT("Process Grants/Revokes"), STAT_GASGlobal_ProcessOps, STATGROUP_GASGlobal);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Grants"), STAT_GASGlobal_Grants, STATGROUP_GASGlobal);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Revokes"), STAT_GASGlobal_Revokes, STATGROUP_GASGlobal);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pending Ops"), STAT_GASGlobal_PendingOps, STATGROUP_GASGlobal);
+
+namespace GlobalGasCvars
+{
+	static bool bTimeSliceGrants = false;
+	static FAutoConsoleVariableRef CVarTimeSliceGrants(
+		TEXT("GAS.Global.TimeSliceGrants"),
+		bTimeSliceGrants,
+		TEXT("Spread global ability/effect grants and revokes across frames instead of running them immediately."),
+		ECVF_Default);
+
+	static float GrantBudgetMs = 1.0f;
+	static FAutoConsoleVariableRef CVarGrantBudgetMs(
+		TEXT("GAS.Global.GrantBudgetMs"),
+		GrantBudgetMs,
+		TEXT("Per-frame time budget for time-sliced global grants/revokes. At least one op runs per frame."),
+		ECVF_Default);
+}
+
 UGlobalGasWorldSubsystem::UGlobalGasWorldSubsystem() {}
 
 void UGlobalGasWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -16,12 +39,43 @@ void UGlobalGasWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	ULOG_INFO(LogTemp, "UGlobalGasWorldSubsystem::Initialize");
 };
 
+void UGlobalGasWorldSubsystem::Deinitialize()
+{
+	PendingOps.Empty();
+	PendingOpsHead = 0;
+	SET_DWORD_STAT(STAT_GASGlobal_PendingOps, 0);
+
+	Super::Deinitialize();
+}
+
+void UGlobalGasWorldSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ProcessPendingOps(FMath::Max(GlobalGasCvars::GrantBudgetMs, 0.f) / 1000.0);
+}
+
+bool UGlobalGasWorldSubsystem::IsTickable() const { return GetNumPendingOps() > 0; }
+
+TStatId UGlobalGasWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGlobalGasWorldSubsystem, STATGROUP_Tickables);
+}
+
 void UGlobalGasWorldSubsystem::ApplyAbilityToAll(TSubclassOf<UGameplayAbility> Ability)
 {
 	if (Ability.Get() != nullptr && !AppliedAbilities.Contains(Ability))
 	{
-		FGlobalAppliedAbilityList& GlobalAppliedAbilities = AppliedAbilities.Add(Ability);
-		for (auto& ASC : RegisteredASCs) { GlobalAppliedAbilities.AddToAsc(Ability, ASC.Get()); }
+		AppliedAbilities.Add(Ability);
+		for (auto& ASC : RegisteredASCs)
+		{
+			FGlobalGasPendingOp Op;
+			Op.Type = EGlobalGasOpType::GrantAbility;
+			Op.Asc = ASC.Get();
+			Op.Ability = Ability;
+			EnqueueOp(MoveTemp(Op));
+		}
+		DispatchPendingOps();
 	}
 }
 
@@ -29,8 +83,24 @@ void UGlobalGasWorldSubsystem::ApplyEffectToAll(TSubclassOf<UGameplayEffect> Eff
 {
 	if (Effect.Get() != nullptr && !AppliedEffects.Contains(Effect))
 	{
-		FGlobalAppliedEffectList& GlobalAppliedEffects = AppliedEffects.Add(Effect);
-		for (auto& Asc : RegisteredASCs) { GlobalAppliedEffects.AddToAsc(Effect, Asc.Get()); }
+		AppliedEffects.Add(Effect);
+		if (RegisteredASCs.IsEmpty()) return;
+
+		// One spec for the whole batch when nothing is captured from the source; each ASC still applies its copy
+		// with its own context and tags. Effects with source captures are built per ASC instead
+		const TSharedPtr<const FGameplayEffectSpec> BatchSpec = CanShareEffectSpec(Effect)
+			                                                        ? MakeSharedEffectSpec(Effect, MakeGlobalEffectContext())
+			                                                        : nullptr;
+		for (auto& Asc : RegisteredASCs)
+		{
+			FGlobalGasPendingOp Op;
+			Op.Type = EGlobalGasOpType::ApplyEffect;
+			Op.Asc = Asc.Get();
+			Op.Effect = Effect;
+			Op.EffectSpec = BatchSpec;
+			EnqueueOp(MoveTemp(Op));
+		}
+		DispatchPendingOps();
 	}
 }
 
@@ -40,8 +110,17 @@ void UGlobalGasWorldSubsystem::RemoveAbilityFromAll(const TSubclassOf<UGameplayA
 	{
 		if (FGlobalAppliedAbilityList* GlobalAppliedAblitities = AppliedAbilities.Find(Ability))
 		{
-			GlobalAppliedAblitities->RemoveFromAll();
+			// Grants still queued for this ability find no list and are skipped, the ones that ran are revoked in order
+			for (auto& Pair : GlobalAppliedAblitities->Handles)
+			{
+				FGlobalGasPendingOp Op;
+				Op.Type = EGlobalGasOpType::RevokeAbility;
+				Op.Asc = Pair.Key.Get();
+				Op.AbilityHandle = Pair.Value;
+				EnqueueOp(MoveTemp(Op));
+			}
 			AppliedAbilities.Remove(Ability);
+			DispatchPendingOps();
 		}
 	}
 }
@@ -52,8 +131,16 @@ void UGlobalGasWorldSubsystem::RemoveEffectFromAll(const TSubclassOf<UGameplayEf
 	{
 		if (FGlobalAppliedEffectList* GlobalAppliedEffects = AppliedEffects.Find(Effect))
 		{
-			GlobalAppliedEffects->RemoveFromAll();
+			for (auto& Pair : GlobalAppliedEffects->Handles)
+			{
+				FGlobalGasPendingOp Op;
+				Op.Type = EGlobalGasOpType::RemoveEffect;
+				Op.Asc = Pair.Key.Get();
+				Op.EffectHandle = Pair.Value;
+				EnqueueOp(MoveTemp(Op));
+			}
 			AppliedEffects.Remove(Effect);
+			DispatchPendingOps();
 		}
 	}
 }
@@ -63,8 +150,26 @@ void UGlobalGasWorldSubsystem::RegisterAsc(UBaseAbilitySystemComponent* Asc)
 	check(Asc);
 	RegisteredASCs.Add(Asc);
 
-	for (auto& Pair : AppliedAbilities) { Pair.Value.AddToAsc(Pair.Key, Asc); }
-	for (auto& Pair : AppliedEffects) { Pair.Value.AddToAsc(Pair.Key, Asc); }
+	for (auto& Pair : AppliedAbilities)
+	{
+		FGlobalGasPendingOp Op;
+		Op.Type = EGlobalGasOpType::GrantAbility;
+		Op.Asc = Asc;
+		Op.Ability = Pair.Key;
+		EnqueueOp(MoveTemp(Op));
+	}
+
+	// A single ASC gains nothing from a shared spec, each effect gets its own context with the ASC as instigator
+	for (auto& Pair : AppliedEffects)
+	{
+		FGlobalGasPendingOp Op;
+		Op.Type = EGlobalGasOpType::ApplyEffect;
+		Op.Asc = Asc;
+		Op.Effect = Pair.Key;
+		EnqueueOp(MoveTemp(Op));
+	}
+
+	DispatchPendingOps();
 }
 
 void UGlobalGasWorldSubsystem::UnregisterAsc(UBaseAbilitySystemComponent* Asc)
@@ -72,6 +177,127 @@ void UGlobalGasWorldSubsystem::UnregisterAsc(UBaseAbilitySystemComponent* Asc)
 	check(Asc);
 	RegisteredASCs.Remove(Asc);
 
+	// Queued grants for this ASC are dropped; queued revokes run now, like the removals below.
+	// The queue is detached from the ASC before any revoke runs, as revokes may re-enter and drain the queue
+	TArray<FGlobalGasPendingOp, TInlineAllocator<8>> RevokeOps;
+	for (int32 OpIndex = PendingOpsHead; OpIndex < PendingOps.Num(); ++OpIndex)
+	{
+		FGlobalGasPendingOp& Op = PendingOps[OpIndex];
+		if (Op.Asc != Asc) continue;
+
+		if (Op.Type == EGlobalGasOpType::RevokeAbility || Op.Type == EGlobalGasOpType::RemoveEffect) RevokeOps.Add(Op);
+		Op.Asc.Reset();
+	}
+	for (const FGlobalGasPendingOp& RevokeOp : RevokeOps) { ExecuteOp(RevokeOp); }
+
 	for (auto& Pair : AppliedAbilities) { Pair.Value.RemoveFromAsc(Asc); }
 	for (auto& Pair : AppliedEffects) { Pair.Value.RemoveFromAsc(Asc); }
 }
+
+void UGlobalGasWorldSubsystem::FlushPendingOps()
+{
+	if (!bIsProcessingOps) ProcessPendingOps(0.0);
+}
+
+void UGlobalGasWorldSubsystem::EnqueueOp(FGlobalGasPendingOp&& Op)
+{
+	PendingOps.Add(MoveTemp(Op));
+	INC_DWORD_STAT(STAT_GASGlobal_PendingOps);
+}
+
+void UGlobalGasWorldSubsystem::DispatchPendingOps()
+{
+	// Ops queued from inside an op are picked up by the loop already running
+	if (bIsProcessingOps || GlobalGasCvars::bTimeSliceGrants) return;
+
+	ProcessPendingOps(0.0);
+}
+
+void UGlobalGasWorldSubsystem::ProcessPendingOps(const double BudgetSeconds)
+{
+	if (bIsProcessingOps || GetNumPendingOps() == 0) return;
+
+	SCOPE_CYCLE_COUNTER(STAT_GASGlobal_ProcessOps);
+	TGuardValue<bool> ProcessingGuard(bIsProcessingOps, true);
+
+	const double StartTime = FPlatformTime::Seconds();
+	int32 NumProcessed = 0;
+	while (PendingOpsHead < PendingOps.Num())
+	{
+		if (BudgetSeconds > 0.0 && NumProcessed > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds) break;
+
+		// Moved out first: the op may queue more ops and reallocate the array
+		const FGlobalGasPendingOp Op = MoveTemp(PendingOps[PendingOpsHead++]);
+		ExecuteOp(Op);
+		++NumProcessed;
+	}
+
+	if (PendingOpsHead == PendingOps.Num())
+	{
+		PendingOps.Reset();
+		PendingOpsHead = 0;
+	}
+	else if (PendingOpsHead > PendingOps.Num() / 2)
+	{
+		PendingOps.RemoveAt(0, PendingOpsHead, EAllowShrinking::No);
+		PendingOpsHead = 0;
+	}
+
+	SET_DWORD_STAT(STAT_GASGlobal_PendingOps, GetNumPendingOps());
+}
+
+void UGlobalGasWorldSubsystem::ExecuteOp(const FGlobalGasPendingOp& Op)
+{
+	UBaseAbilitySystemComponent* Asc = Op.Asc.Get();
+	if (!Asc) return;
+
+	switch (Op.Type)
+	{
+	case EGlobalGasOpType::GrantAbility:
+		if (FGlobalAppliedAbilityList* List = AppliedAbilities.Find(Op.Ability))
+		{
+			List->AddToAsc(Op.Ability, Asc);
+			INC_DWORD_STAT(STAT_GASGlobal_Grants);
+		}
+		break;
+	case EGlobalGasOpType::ApplyEffect:
+		if (FGlobalAppliedEffectList* List = AppliedEffects.Find(Op.Effect))
+		{
+			List->AddToAsc(Op.Effect, Asc, Op.EffectSpec.Get());
+			INC_DWORD_STAT(STAT_GASGlobal_Grants);
+		}
+		break;
+	case EGlobalGasOpType::RevokeAbility:
+		Asc->ClearAbility(Op.AbilityHandle);
+		INC_DWORD_STAT(STAT_GASGlobal_Revokes);
+		break;
+	case EGlobalGasOpType::RemoveEffect:
+		Asc->RemoveActiveGameplayEffect(Op.EffectHandle);
+		INC_DWORD_STAT(STAT_GASGlobal_Revokes);
+		break;
+	}
+}
+
+FGameplayEffectContextHandle UGlobalGasWorldSubsystem::MakeGlobalEffectContext() const
+{
+	FGameplayEffectContextHandle Context(UAbilitySystemGlobals::Get().AllocGameplayEffectContext());
+	Context.AddSourceObject(this);
+	return Context;
+}
+
+bool UGlobalGasWorldSubsystem::CanShareEffectSpec(const TSubclassOf<UGameplayEffect>& Effect)
+{
+	TArray<FGameplayEffectAttributeCaptureDefinition> CaptureDefinitions;
+	Effect->GetDefaultObject<UGameplayEffect>()->GetAttributeCaptureDefinitions(CaptureDefinitions);
+
+	return !CaptureDefinitions.ContainsByPredicate([](const FGameplayEffectAttributeCaptureDefinition& Definition)
+	{
+		return Definition.AttributeSource == EGameplayEffectAttributeCaptureSource::Source;
+	});
+}
+
+TSharedPtr<const FGameplayEffectSpec> UGlobalGasWorldSubsystem::MakeSharedEffectSpec(
+	const TSubclassOf<UGameplayEffect>& Effect, const FGameplayEffectContextHandle& Context)
+{
+	return MakeShared<FGameplayEffectSpec>(Effect->GetDefaultObject<UGameplayEffect>(), Context, /*Level=*/ 1.f);
+}
@@ -2,30 +2,83 @@
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BaseAbilityTagRelationshipMapping)
 
+namespace
+{
+	/** Distinct AbilityTags containers memoized per mapping; past this, results are resolved without being cached */
+	constexpr int32 MaxResolvedCacheEntries = 1024;
+}
+
+void FResolvedAbilityTagRelationships::Append(const FResolvedAbilityTagRelationships& Other)
+{
+	AbilityTagsToBlock.AppendTags(Other.AbilityTagsToBlock);
+	AbilityTagsToCancel.AppendTags(Other.AbilityTagsToCancel);
+	ActivationRequiredTags.AppendTags(Other.ActivationRequiredTags);
+	ActivationBlockedTags.AppendTags(Other.ActivationBlockedTags);
+}
+
+UBaseAbilityTagRelationshipMapping::FAbilityTagsKey::FAbilityTagsKey(const FGameplayTagContainer& InTags)
+	: Tags(InTags), Hash(InTags.Num())
+{
+	// Summed so the key does not depend on tag order, matching FGameplayTagContainer::operator==
+	for (const FGameplayTag& Tag : Tags) Hash += GetTypeHash(Tag);
+}
+
+template <typename VisitorType>
+void UBaseAbilityTagRelationshipMapping::VisitResolvedRelationships(const FGameplayTagContainer& AbilityTags,
+                                                                     VisitorType&& Visitor) const
+{
+	if (AbilityTags.IsEmpty()) return;
+
+	BuildRelationshipIndexIfNeeded();
+
+	const FAbilityTagsKey Key(AbilityTags);
+	FResolvedAbilityTagRelationships Resolved;
+	{
+		FReadScopeLock ReadLock(IndexLock);
+		if (const TUniquePtr<FResolvedAbilityTagRelationships>* Cached = ResolvedCache.Find(Key))
+		{
+			Visitor(**Cached);
+			return;
+		}
+
+		// HasTag also matches parents of the ability's tags, so look up every tag together with its parents
+		for (const FGameplayTag& Tag : AbilityTags.GetGameplayTagParents())
+		{
+			if (const FResolvedAbilityTagRelationships* Entry = RelationshipIndex.Find(Tag)) Resolved.Append(*Entry);
+		}
+	}
+
+	FWriteScopeLock WriteLock(IndexLock);
+	if (ResolvedCache.Num() >= MaxResolvedCacheEntries || !bRelationshipIndexBuilt)
+	{
+		Visitor(Resolved);
+		return;
+	}
+
+	TUniquePtr<FResolvedAbilityTagRelationships>& Cached = ResolvedCache.FindOrAdd(Key);
+	if (!Cached) Cached = MakeUnique<FResolvedAbilityTagRelationships>(MoveTemp(Resolved));
+	Visitor(*Cached);
+}
+
 void UBaseAbilityTagRelationshipMapping::GetAbilityTagsToBlockAndCancel(
 	const FGameplayTagContainer& AbilityTags,
 	FGameplayTagContainer* OutTagsToBlock,
 	FGameplayTagContainer* OutTagsToCancel) const
 {
-	// Simple iteration for now
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
-	{
-		const FAbilityTagRelationship& Tags = AbilityTagRelationships[i];
-		if (!AbilityTags.HasTag(Tags.AbilityTag))
-		{
-			continue;
-		}
+	if (!OutTagsToBlock && !OutTagsToCancel) return;
 
+	VisitResolvedRelationships(AbilityTags, [&](const FResolvedAbilityTagRelationships& Resolved)
+	{
 		if (OutTagsToBlock)
 		{
-			OutTagsToBlock->AppendTags(Tags.AbilityTagsToBlock);
+			OutTagsToBlock->AppendTags(Resolved.AbilityTagsToBlock);
 		}
 
 		if (OutTagsToCancel)
 		{
-			OutTagsToCancel->AppendTags(Tags.AbilityTagsToCancel);
+			OutTagsToCancel->AppendTags(Resolved.AbilityTagsToCancel);
 		}
-	}
+	});
 }
 
 void UBaseAbilityTagRelationshipMapping::GetRequiredAndBlockedActivationTags(
@@ -33,39 +86,80 @@ void UBaseAbilityTagRelationshipMapping::GetRequiredAndBlockedActivationTags(
 	FGameplayTagContainer* OutActivationRequired,
 	FGameplayTagContainer* OutActivationBlocked) const
 {
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
-	{
-		const FAbilityTagRelationship& Tags = AbilityTagRelationships[i];
-		if (!AbilityTags.HasTag(Tags.AbilityTag))
-		{
-			continue;
-		}
+	if (!OutActivationRequired && !OutActivationBlocked) return;
 
+	VisitResolvedRelationships(AbilityTags, [&](const FResolvedAbilityTagRelationships& Resolved)
+	{
 		if (OutActivationRequired)
 		{
-			OutActivationRequired->AppendTags(Tags.ActivationRequiredTags);
+			OutActivationRequired->AppendTags(Resolved.ActivationRequiredTags);
 		}
 
 		if (OutActivationBlocked)
 		{
-			OutActivationBlocked->AppendTags(Tags.ActivationBlockedTags);
+			OutActivationBlocked->AppendTags(Resolved.ActivationBlockedTags);
 		}
-	}
+	});
 }
 
 bool UBaseAbilityTagRelationshipMapping::IsAbilityCancelledByTag(
 	const FGameplayTagContainer& AbilityTags,
 	const FGameplayTag& ActionTag) const
 {
-	for (int32 i = 0; i < AbilityTagRelationships.Num(); i++)
+	BuildRelationshipIndexIfNeeded();
+
+	FReadScopeLock ReadLock(IndexLock);
+	const FResolvedAbilityTagRelationships* Relationships = RelationshipIndex.Find(ActionTag);
+	return Relationships && Relationships->AbilityTagsToCancel.HasAny(AbilityTags);
+}
+
+void UBaseAbilityTagRelationshipMapping::PostLoad()
+{
+	Super::PostLoad();
+
+	InvalidateRelationshipIndex();
+}
+
+#if WITH_EDITOR
+void UBaseAbilityTagRelationshipMapping::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	InvalidateRelationshipIndex();
+}
+#endif
+
+void UBaseAbilityTagRelationshipMapping::InvalidateRelationshipIndex()
+{
+	FWriteScopeLock WriteLock(IndexLock);
+	RelationshipIndex.Reset();
+	ResolvedCache.Reset();
+	bRelationshipIndexBuilt = false;
+}
+
+void UBaseAbilityTagRelationshipMapping::BuildRelationshipIndexIfNeeded() const
+{
 	{
-		const FAbilityTagRelationship& Tags = AbilityTagRelationships[i];
+		FReadScopeLock ReadLock(IndexLock);
+		if (bRelationshipIndexBuilt) return;
+	}
 
-		if (Tags.AbilityTag == ActionTag && Tags.AbilityTagsToCancel.HasAny(AbilityTags))
-		{
-			return true;
-		}
+	FWriteScopeLock WriteLock(IndexLock);
+	if (bRelationshipIndexBuilt) return;
+
+	// Rows sharing an AbilityTag are merged, so a lookup never has to visit more than one entry per tag
+	RelationshipIndex.Reset();
+	for (const FAbilityTagRelationship& Tags : AbilityTagRelationships)
+	{
+		if (!Tags.AbilityTag.IsValid()) continue;
+
+		FResolvedAbilityTagRelationships& Entry = RelationshipIndex.FindOrAdd(Tags.AbilityTag);
+		Entry.AbilityTagsToBlock.AppendTags(Tags.AbilityTagsToBlock);
+		Entry.AbilityTagsToCancel.AppendTags(Tags.AbilityTagsToCancel);
+		Entry.ActivationRequiredTags.AppendTags(Tags.ActivationRequiredTags);
+		Entry.ActivationBlockedTags.AppendTags(Tags.ActivationBlockedTags);
 	}
 
-	return false;
+	ResolvedCache.Reset();
+	bRelationshipIndexBuilt = true;
 }
@@ -13,6 +13,17 @@ class UBaseGameplayAbility;
 struct FFrame;
 struct FGameplayAbilityTargetDataHandle;
 
+/** Aggregate cost of one bulk gameplay effect application */
+struct FBulkGameplayEffectStats
+{
+	int32 NumTargets = 0;
+	int32 NumApplied = 0;
+	/** Building the shared spec: context, source tags and source attribute captures */
+	double SpecSetupSeconds = 0.0;
+	/** Applying the spec to every target: target captures, executions, aggregation */
+	double ApplySeconds = 0.0;
+};
+
 UCLASS()
 class ABILITYSYSTEM_API UBaseAbilitySystemComponent : public UAbilitySystemComponent
 {
@@ -44,11 +55,18 @@ public:
 
 	void ProcessAbilityInput(float DeltaTime, bool bGamePaused);
 
+	/** Re-indexes the input tags of a granted spec. Call after changing its dynamic spec source tags. */
+	void NotifyAbilityInputTagsChanged(FGameplayAbilitySpec& Spec);
+
 private:
-	TSet<FGameplayAbilitySpecHandle> ProcessHeldAbilities();
-	TSet<FGameplayAbilitySpecHandle> ProcessPressedAbilities();
+	void ProcessHeldAbilities(TSet<FGameplayAbilitySpecHandle>& OutAbilitiesToActivate);
+	void ProcessPressedAbilities(TSet<FGameplayAbilitySpecHandle>& OutAbilitiesToActivate);
 	void ProcessReleasedAbilities();
 
+	void AddToInputTagIndex(const FGameplayAbilitySpec& Spec);
+	void RemoveFromInputTagIndex(FGameplayAbilitySpecHandle Handle);
+	void RebuildInputTagIndex();
+
 public:
 	void ClearAbilityInput();
 	bool IsActivationGroupBlocked(EAbilityActivationGroup Group) const;
@@ -64,6 +82,22 @@ public:
 	// Removes all active instances of the gameplay effect that was used to add the specified dynamic granted tag.
 	void RemoveDynamicTagGameplayEffect(const TSoftClassPtr<UGameplayEffect>&, const FGameplayTag& Tag);
 
+	/**
+	 * Applies one spec to every target. Context and source captures were computed once when the spec was made;
+	 * each target only captures its own tags and attributes (the spec itself is copied, never modified).
+	 * @return One handle per target, in order; check WasSuccessfullyApplied()
+	 */
+	TArray<FActiveGameplayEffectHandle> ApplyGameplayEffectSpecToTargets(const FGameplayEffectSpec& Spec,
+	                                                                     TConstArrayView<UAbilitySystemComponent*> Targets,
+	                                                                     FBulkGameplayEffectStats* OutStats = nullptr);
+
+	/** Makes one outgoing spec from this ASC (with Context, or a new one) and applies it to every target */
+	TArray<FActiveGameplayEffectHandle> ApplyGameplayEffectToTargets(TSubclassOf<UGameplayEffect> GameplayEffectClass,
+	                                                                 float Level,
+	                                                                 TConstArrayView<UAbilitySystemComponent*> Targets,
+	                                                                 FGameplayEffectContextHandle Context = FGameplayEffectContextHandle(),
+	                                                                 FBulkGameplayEffectStats* OutStats = nullptr);
+
 	/** Gets the ability target data associated with the given ability handle and activation info */
 	void GetAbilityTargetData(const FGameplayAbilitySpecHandle AbilityHandle,
 	                          const FGameplayAbilityActivationInfo& ActivationInfo,
@@ -80,6 +114,12 @@ public:
 protected:
 	void TryActivateAbilitiesOnSpawn();
 
+	//~UAbilitySystemComponent interface
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRep_ActivateAbilities() override;
+	//~End of UAbilitySystemComponent interface
+
 	virtual void AbilitySpecInputPressed(FGameplayAbilitySpec& Spec) override;
 	virtual void AbilitySpecInputReleased(FGameplayAbilitySpec& Spec) override;
 
@@ -120,6 +160,15 @@ protected:
 	// Handles to abilities that have their input held.
 	TArray<FGameplayAbilitySpecHandle> InputHeldSpecHandlesList;
 
+	// Granted abilities by the dynamic spec source tags they were given with (their input tags), kept in sync on give/remove.
+	TMap<FGameplayTag, TArray<FGameplayAbilitySpecHandle, TInlineAllocator<2>>> InputTagToSpecHandles;
+
+	// Tags each spec is indexed under, to unindex it without the spec (it may already be gone on remove).
+	TMap<FGameplayAbilitySpecHandle, FGameplayTagContainer> IndexedSpecInputTags;
+
+	// Reused by ProcessAbilityInput every frame so it doesn't allocate.
+	TSet<FGameplayAbilitySpecHandle> AbilitiesToActivateScratch;
+
 	// Number of abilities running in each activation group.
 	int32 ActivationGroupCounts[static_cast<uint8>(EAbilityActivationGroup::Max)];
 };
\ No newline at end of file
@@ -5,6 +5,7 @@
 
 class FString;
 class UClass;
+class UExperienceDefinition_DA;
 class UObject;
 class UWorld;
 struct FObjectKey;
@@ -35,6 +36,9 @@ public:
 
 	static void DumpGameplayCues(const TArray<FString>& Args);
 
+	// Reports the cues predicted from the experience and the cues that were still loaded after gameplay began
+	static void DumpGameplayCueCoverage(const TArray<FString>& Args);
+
 	// When delay loading cues, this will load the cues that must be always loaded anyway
 	void LoadAlwaysLoadedCues();
 
@@ -47,7 +51,14 @@ private:
 	void ProcessLoadedTags();
 	void ProcessTagToPreload(const FGameplayTag& Tag, UObject* OwningObject);
 	void OnPreloadCueComplete(FSoftObjectPath Path, TWeakObjectPtr<UObject> OwningObject, bool bAlwaysLoadedCue);
-	void RegisterPreloadedCue(UClass* LoadedGameplayCueClass, UObject* OwningObject);
+	void RegisterPreloadedCue(UClass* LoadedGameplayCueClass, const UObject* OwningObject);
+
+	// Predictive preloading: once an experience's bundles are loaded, preload the cues its abilities and effects reference
+	void HandleExperienceBundlesLoaded(const UExperienceDefinition_DA* Experience);
+	void HandleExperienceLoaded(const UExperienceDefinition_DA* Experience);
+	void CollectReferencedCueTags(const UObject* Root, TSet<FGameplayTag>& OutCueTags) const;
+	void OnPredictedCuesLoaded(TArray<FSoftObjectPath> Paths, TWeakObjectPtr<const UExperienceDefinition_DA> WeakExperience);
+	void ReleasePredictedCues();
 	void HandlePostLoadMap(UWorld* NewWorld);
 	void UpdateDelayLoadDelegateListeners();
 	bool ShouldDelayLoadGameplayCues() const;
@@ -76,6 +87,15 @@ private:
 	UPROPERTY(transient)
 	TSet<TObjectPtr<UClass>> AlwaysLoadedCues;
 
+	// Cue tags predicted from the experiences loading (or loaded) for the current match, and the experiences they came from
+	TSet<FGameplayTag> PredictedCueTags;
+	TSet<FObjectKey> PredictingExperiences;
+
+	// Cues whose notify was in memory when gameplay first began with the predicting experiences, any other cue loaded
+	// after that was loaded late. Only reset when an experience that wasn't predicting yet loads (a new match)
+	TSet<FGameplayTag> CuesLoadedAtGameplayStart;
+	bool bGameplayStarted = false;
+
 	TArray<FLoadedGameplayTagToProcessData> LoadedGameplayTagsToProcess;
 	FCriticalSection LoadedGameplayTagsToProcessCS;
 	bool bProcessLoadedTagsAfterGC = false;
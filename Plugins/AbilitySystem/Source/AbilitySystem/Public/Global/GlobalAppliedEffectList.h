@@ -6,6 +6,7 @@
 
 class UGameplayEffect;
 class UBaseAbilitySystemComponent;
+struct FGameplayEffectSpec;
 struct FActiveGameplayEffectHandle;
 
 
@@ -17,7 +18,12 @@ struct FGlobalAppliedEffectList
 	UPROPERTY()
 	TMap<TObjectPtr<UBaseAbilitySystemComponent>, FActiveGameplayEffectHandle> Handles;
 
-	void AddToAsc(const TSubclassOf<UGameplayEffect>& Effect, UBaseAbilitySystemComponent* Asc);
+	/**
+	 * Applies a copy of SharedSpec to Asc, with its context and source tags replaced by Asc's own,
+	 * or a new spec of Effect with a context made by Asc when none is given
+	 */
+	void AddToAsc(const TSubclassOf<UGameplayEffect>& Effect, UBaseAbilitySystemComponent* Asc,
+	              const FGameplayEffectSpec* SharedSpec = nullptr);
 	void RemoveFromAsc(UBaseAbilitySystemComponent* Asc);
 	void RemoveFromAll();
 };
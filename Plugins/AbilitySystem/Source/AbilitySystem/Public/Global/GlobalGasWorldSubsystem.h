@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Subsystems/WorldSubsystem.h"
+#include "GameplayEffect.h"
 #include "Global/GlobalAppliedAbilityList.h"
 #include "Global/GlobalAppliedEffectList.h"
 #include "GlobalGasWorldSubsystem.generated.h"
@@ -15,6 +16,29 @@ struct FGameplayAbilitySpecHandle;
 struct FGlobalAppliedAbilityList;
 struct FGlobalAppliedEffectList;
 
+DECLARE_STATS_GROUP(TEXT("GAS.Global"), STATGROUP_GASGlobal, STATCAT_Advanced);
+
+/** Kind of work queued by UGlobalGasWorldSubsystem */
+enum class EGlobalGasOpType : uint8
+{
+	GrantAbility,
+	RevokeAbility,
+	ApplyEffect,
+	RemoveEffect
+};
+
+/** One grant or revoke of a global ability/effect on one ASC. Ops run in queue order, so per-ASC order is kept */
+struct FGlobalGasPendingOp
+{
+	EGlobalGasOpType Type = EGlobalGasOpType::GrantAbility;
+	TWeakObjectPtr<UBaseAbilitySystemComponent> Asc;
+	TSubclassOf<UGameplayAbility> Ability;
+	TSubclassOf<UGameplayEffect> Effect;
+	FGameplayAbilitySpecHandle AbilityHandle;
+	FActiveGameplayEffectHandle EffectHandle;
+	/** Shared by every ApplyEffect op of the same batch, so the spec is only built once. Null to build one per ASC */
+	TSharedPtr<const FGameplayEffectSpec> EffectSpec;
+};
 
 /**
 * The UGlobalGasWorldSubsystem provides a centralized system for managing globally-applied effects and interactions within the game world.
@@ -36,13 +60,20 @@ music or applying a post-processing effect to the entire game world.
  */
 
 UCLASS()
-class ABILITYSYSTEM_API UGlobalGasWorldSubsystem : public UWorldSubsystem
+class ABILITYSYSTEM_API UGlobalGasWorldSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	UGlobalGasWorldSubsystem();
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
 
 	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "Base")
 	void ApplyAbilityToAll(TSubclassOf<UGameplayAbility> Ability);
@@ -62,7 +93,40 @@ public:
 	/** Removes an ASC from the global system, along with any active global effects/abilities. */
 	void UnregisterAsc(UBaseAbilitySystemComponent* Asc);
 
+	/** Runs every queued grant/revoke now, ignoring the time-slicing budget */
+	void FlushPendingOps();
+
+	int32 GetNumPendingOps() const { return PendingOps.Num() - PendingOpsHead; }
+
 private:
+	void EnqueueOp(FGlobalGasPendingOp&& Op);
+
+	/**
+	 * Runs the queue right away unless time-slicing is on (GAS.Global.TimeSliceGrants),
+	 * in which case Tick drains it within GAS.Global.GrantBudgetMs per frame.
+	 */
+	void DispatchPendingOps();
+	void ProcessPendingOps(double BudgetSeconds);
+	void ExecuteOp(const FGlobalGasPendingOp& Op);
+
+	/** Context the shared spec is built with, replaced by each ASC's own context when applied */
+	FGameplayEffectContextHandle MakeGlobalEffectContext() const;
+
+	/**
+	 * True if ApplyEffectToAll may build one spec for every ASC: the effect captures no attributes from its source.
+	 * Each ASC still applies a copy with its own context (as instigator) and its own source tags, so source tag
+	 * requirements, MMCs, executions and cues see the same source as an unbatched application.
+	 */
+	static bool CanShareEffectSpec(const TSubclassOf<UGameplayEffect>& Effect);
+
+	static TSharedPtr<const FGameplayEffectSpec> MakeSharedEffectSpec(const TSubclassOf<UGameplayEffect>& Effect,
+	                                                                 const FGameplayEffectContextHandle& Context);
+
+	/** FIFO of grants/revokes; entries before PendingOpsHead already ran */
+	TArray<FGlobalGasPendingOp> PendingOps;
+	int32 PendingOpsHead = 0;
+	bool bIsProcessingOps = false;
+
 	UPROPERTY()
 	TMap<TSubclassOf<UGameplayAbility>, FGlobalAppliedAbilityList> AppliedAbilities;
 
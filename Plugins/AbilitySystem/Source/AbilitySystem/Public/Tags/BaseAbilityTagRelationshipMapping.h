@@ -42,6 +42,17 @@ struct FAbilityTagRelationship
 	FGameplayTagContainer ActivationBlockedTags;
 };
 
+/** All relationships of one ability tag (or one set of ability tags), merged across rows */
+struct FResolvedAbilityTagRelationships
+{
+	FGameplayTagContainer AbilityTagsToBlock;
+	FGameplayTagContainer AbilityTagsToCancel;
+	FGameplayTagContainer ActivationRequiredTags;
+	FGameplayTagContainer ActivationBlockedTags;
+
+	void Append(const FResolvedAbilityTagRelationships& Other);
+};
+
 /** Mapping of how ability tags block or cancel other abilities  */
 UCLASS()
 class UBaseAbilityTagRelationshipMapping : public UDataAsset
@@ -76,4 +87,42 @@ public:
 	 * @return True if the ability is canceled by the action tag
 	*/
 	bool IsAbilityCancelledByTag(const FGameplayTagContainer& AbilityTags, const FGameplayTag& ActionTag) const;
+
+	//~UObject interface
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+	//~End of UObject interface
+
+	/** Drops the tag index and the memoized results, they are rebuilt on the next query */
+	void InvalidateRelationshipIndex();
+
+private:
+	/** Order-independent key for memoized AbilityTags containers */
+	struct FAbilityTagsKey
+	{
+		explicit FAbilityTagsKey(const FGameplayTagContainer& InTags);
+
+		bool operator==(const FAbilityTagsKey& Other) const { return Hash == Other.Hash && Tags == Other.Tags; }
+		friend uint32 GetTypeHash(const FAbilityTagsKey& Key) { return Key.Hash; }
+
+		FGameplayTagContainer Tags;
+		uint32 Hash;
+	};
+
+	/** Calls Visitor with the merged relationships of every row whose AbilityTag matches AbilityTags (HasTag semantics) */
+	template <typename VisitorType>
+	void VisitResolvedRelationships(const FGameplayTagContainer& AbilityTags, VisitorType&& Visitor) const;
+
+	void BuildRelationshipIndexIfNeeded() const;
+
+	/** Ability tag -> relationships of all rows using exactly that tag */
+	mutable TMap<FGameplayTag, FResolvedAbilityTagRelationships> RelationshipIndex;
+
+	/** AbilityTags container -> resolved relationships. Abilities reuse a handful of containers, so this stays small */
+	mutable TMap<FAbilityTagsKey, TUniquePtr<FResolvedAbilityTagRelationships>> ResolvedCache;
+
+	mutable FRWLock IndexLock;
+	mutable bool bRelationshipIndexBuilt = false;
 };
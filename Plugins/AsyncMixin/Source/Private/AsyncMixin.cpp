@@ -8,7 +8,10 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogAsyncMixin, Log, All);
 
-TMap<FAsyncMixin*, TSharedRef<FAsyncMixin::FLoadingState>> FAsyncMixin::Loading;
+TArray<TWeakPtr<FAsyncMixin::FLoadingState>> FAsyncMixin::PendingStarts;
+TArray<TWeakPtr<FAsyncMixin::FLoadingState>> FAsyncMixin::PendingReleases;
+TArray<TWeakPtr<FAsyncCondition>> FAsyncMixin::PolledConditions;
+FTSTicker::FDelegateHandle FAsyncMixin::DeferredWorkHandle;
 
 FAsyncMixin::FAsyncMixin()
 {
@@ -18,34 +21,38 @@ FAsyncMixin::~FAsyncMixin()
 {
 	check(IsInGameThread());
 
-	// Removing the loading state will cancel any pending loadings it was 
-	// monitoring, and shouldn't receive any future callbacks for completion.
-	Loading.Remove(this);
+	// Detaching the loading state will cancel any pending loadings it was monitoring, and it shouldn't receive any
+	// future callbacks for completion.  It may outlive us for a moment if we're destroyed from one of its callbacks.
+	if (LoadingState.IsValid())
+	{
+		LoadingState->DetachOwner();
+		LoadingState.Reset();
+	}
 }
 
 const FAsyncMixin::FLoadingState& FAsyncMixin::GetLoadingStateConst() const
 {
 	check(IsInGameThread());
-	return Loading.FindChecked(this).Get();
+	return *LoadingState;
 }
 
 FAsyncMixin::FLoadingState& FAsyncMixin::GetLoadingState()
 {
 	check(IsInGameThread());
 
-	if (TSharedRef<FLoadingState>* LoadingState = Loading.Find(this))
+	if (!LoadingState.IsValid())
 	{
-		return (*LoadingState).Get();
+		LoadingState = MakeShared<FLoadingState>(*this);
 	}
 
-	return Loading.Add(this, MakeShared<FLoadingState>(*this)).Get();
+	return *LoadingState;
 }
 
 bool FAsyncMixin::HasLoadingState() const
 {
 	check(IsInGameThread());
 
-	return Loading.Contains(this);
+	return LoadingState.IsValid();
 }
 
 void FAsyncMixin::CancelAsyncLoading()
@@ -119,18 +126,85 @@ void FAsyncMixin::StartAsyncLoading()
 	}
 }
 
+void FAsyncMixin::EnsureDeferredWorkTicker()
+{
+	if (!DeferredWorkHandle.IsValid())
+	{
+		DeferredWorkHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&FAsyncMixin::TickDeferredWork));
+	}
+}
+
+bool FAsyncMixin::TickDeferredWork(float DeltaTime)
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FAsyncMixin_TickDeferredWork);
+
+	// Starting or releasing can queue more work, which belongs to the next frame.  Swapping with the scratch arrays
+	// keeps both allocations around.
+	static TArray<TWeakPtr<FLoadingState>> Starts;
+	Swap(Starts, PendingStarts);
+	for (const TWeakPtr<FLoadingState>& WeakState : Starts)
+	{
+		const TSharedPtr<FLoadingState> State = WeakState.Pin();
+		if (State.IsValid() && State->IsStartScheduled())
+		{
+			QUICK_SCOPE_CYCLE_COUNTER(STAT_FAsyncMixin_FLoadingState_TryScheduleStartDelegate);
+			State->Start();
+		}
+	}
+	Starts.Reset();
+
+	static TArray<TWeakPtr<FLoadingState>> Releases;
+	Swap(Releases, PendingReleases);
+	for (const TWeakPtr<FLoadingState>& WeakState : Releases)
+	{
+		const TSharedPtr<FLoadingState> State = WeakState.Pin();
+		if (State.IsValid() && State->IsPendingDestroy())
+		{
+			State->ReleaseMemory();
+		}
+	}
+	Releases.Reset();
+
+	// Completing a condition can add new ones at the end, so go by index and only ever remove the current one.
+	for (int32 ConditionIndex = 0; ConditionIndex < PolledConditions.Num();)
+	{
+		const TSharedPtr<FAsyncCondition> Condition = PolledConditions[ConditionIndex].Pin();
+		if (!Condition.IsValid() || !Condition->bPolling)
+		{
+			PolledConditions.RemoveAtSwap(ConditionIndex, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		Condition->TimeUntilPoll -= DeltaTime;
+		if (Condition->TimeUntilPoll <= 0.0f)
+		{
+			Condition->TimeUntilPoll = FAsyncCondition::PollInterval;
+			Condition->TryToContinue();
+		}
+
+		++ConditionIndex;
+	}
+
+	const bool bHasWork = PendingStarts.Num() > 0 || PendingReleases.Num() > 0 || PolledConditions.Num() > 0;
+	if (!bHasWork)
+	{
+		DeferredWorkHandle.Reset();
+	}
+
+	return bHasWork;
+}
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 
 FAsyncMixin::FLoadingState::FLoadingState(FAsyncMixin& InOwner)
-	: OwnerRef(InOwner)
+	: Owner(&InOwner)
 {
 }
 
 FAsyncMixin::FLoadingState::~FLoadingState()
 {
-	QUICK_SCOPE_CYCLE_COUNTER(STAT_FAsyncMixin_FLoadingState_DestroyThisMemoryDelegate);
-	UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] Destroy LoadingState (Done)"), this);
+	UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] Destroy LoadingState (Owner Destroyed)"), this);
 
 	// If we get destroyed, need to cancel whatever we're doing and cancel any
 	// pending destruction - as we're already on the way out.
@@ -167,6 +241,26 @@ void FAsyncMixin::FLoadingState::CancelAndDestroy()
 	RequestDestroyThisMemory();
 }
 
+void FAsyncMixin::FLoadingState::DetachOwner()
+{
+	CancelOnly(/*bDestroying*/true);
+	CancelDestroyThisMemory(/*bDestroying*/true);
+	Owner = nullptr;
+}
+
+void FAsyncMixin::FLoadingState::ReleaseMemory()
+{
+	QUICK_SCOPE_CYCLE_COUNTER(STAT_FAsyncMixin_FLoadingState_DestroyThisMemoryDelegate);
+	UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] Destroy LoadingState (Done)"), this);
+
+	bReleaseScheduled = false;
+
+	// The state itself stays with the owner for the next load, only the step memory goes away.
+	AsyncSteps.Empty();
+	AsyncStepsPendingDestruction.Empty();
+	CurrentAsyncStep = 0;
+}
+
 void FAsyncMixin::FLoadingState::CancelDestroyThisMemory(bool bDestroying)
 {
 	// If we've schedule the memory to be deleted we need to abort that.
@@ -177,8 +271,8 @@ void FAsyncMixin::FLoadingState::CancelDestroyThisMemory(bool bDestroying)
 			UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] Destroy LoadingState (Canceled)"), this);
 		}
 
-		FTSTicker::GetCoreTicker().RemoveTicker(DestroyMemoryDelegate);
-		DestroyMemoryDelegate.Reset();
+		// Left in PendingReleases, the ticker skips states that are no longer flagged.
+		bReleaseScheduled = false;
 	}
 }
 
@@ -189,21 +283,16 @@ void FAsyncMixin::FLoadingState::RequestDestroyThisMemory()
 	{
 		UE_LOG(LogAsyncMixin, Verbose, TEXT("[0x%X] Destroy LoadingState (Requested)"), this);
 
-		DestroyMemoryDelegate = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float DeltaTime) {
-			// Remove any memory we were using.
-			FAsyncMixin::Loading.Remove(&OwnerRef);
-			return false;
-		}));
+		bReleaseScheduled = true;
+		PendingReleases.Add(AsShared());
+		EnsureDeferredWorkTicker();
 	}
 }
 
 void FAsyncMixin::FLoadingState::CancelStartTimer()
 {
-	if (StartTimerDelegate.IsValid())
-	{
-		FTSTicker::GetCoreTicker().RemoveTicker(StartTimerDelegate);
-		StartTimerDelegate.Reset();
-	}
+	// Left in PendingStarts, the ticker skips states that are no longer flagged.
+	bStartScheduled = false;
 }
 
 void FAsyncMixin::FLoadingState::Start()
@@ -218,7 +307,10 @@ void FAsyncMixin::FLoadingState::Start()
 	if (!bHasStarted)
 	{
 		bHasStarted = true;
-		OwnerRef.OnStartedLoading();
+		if (Owner)
+		{
+			Owner->OnStartedLoading();
+		}
 	}
 	
 	TryCompleteAsyncLoading();
@@ -301,13 +393,11 @@ void FAsyncMixin::FLoadingState::TryScheduleStart()
 	CancelDestroyThisMemory(/*bDestroying*/false);
 
 	// In the event the user forgets to start async loading, we'll begin doing it next frame.
-	if (!StartTimerDelegate.IsValid())
+	if (!bStartScheduled)
 	{
-		StartTimerDelegate = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this](float DeltaTime) {
-			QUICK_SCOPE_CYCLE_COUNTER(STAT_FAsyncMixin_FLoadingState_TryScheduleStartDelegate);
-			Start();
-			return false;
-		}));
+		bStartScheduled = true;
+		PendingStarts.Add(AsShared());
+		EnsureDeferredWorkTicker();
 	}
 }
 
@@ -333,12 +423,7 @@ bool FAsyncMixin::FLoadingState::IsLoadingInProgress() const
 
 bool FAsyncMixin::FLoadingState::IsLoadingInProgressOrPending() const
 {
-	return StartTimerDelegate.IsValid() || IsLoadingInProgress();
-}
-
-bool FAsyncMixin::FLoadingState::IsPendingDestroy() const
-{
-	return DestroyMemoryDelegate.IsValid();
+	return bStartScheduled || IsLoadingInProgress();
 }
 
 void FAsyncMixin::FLoadingState::TryCompleteAsyncLoading()
@@ -402,7 +487,10 @@ void FAsyncMixin::FLoadingState::CompleteAsyncLoading()
 	if (bHasStarted)
 	{
 		bHasStarted = false;
-		OwnerRef.OnFinishedLoading();
+		if (Owner)
+		{
+			Owner->OnFinishedLoading();
+		}
 	}
 
 	// It's unlikely but possible they started loading more stuff in the OnFinishedLoading callback,
@@ -516,19 +604,20 @@ bool FAsyncMixin::FLoadingState::FAsyncStep::IsCompleteDelegateBound() const
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 
-FAsyncCondition::FAsyncCondition(const FAsyncConditionDelegate& Condition)
+FAsyncCondition::FAsyncCondition(const FAsyncConditionDelegate& Condition, const EAsyncConditionWake InWake)
 	: UserCondition(Condition)
+	, Wake(InWake)
 {
 }
 
-FAsyncCondition::FAsyncCondition(TFunction<EAsyncConditionResult()>&& Condition)
+FAsyncCondition::FAsyncCondition(TFunction<EAsyncConditionResult()>&& Condition, const EAsyncConditionWake InWake)
 	: UserCondition(FAsyncConditionDelegate::CreateLambda([UserFunction = MoveTemp(Condition)]() mutable { return UserFunction(); }))
+	, Wake(InWake)
 {
 }
 
 FAsyncCondition::~FAsyncCondition()
 {
-	FTSTicker::GetCoreTicker().RemoveTicker(RepeatHandle);
 }
 
 bool FAsyncCondition::IsComplete() const
@@ -552,15 +641,29 @@ bool FAsyncCondition::BindCompleteDelegate(const FSimpleDelegate& NewDelegate)
 
 	CompletionDelegate = NewDelegate;
 
-	if (!RepeatHandle.IsValid())
+	if (Wake == EAsyncConditionWake::Poll && !bPolling)
 	{
-		RepeatHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FAsyncCondition::TryToContinue), 0.16);
+		bPolling = true;
+		TimeUntilPoll = PollInterval;
+		FAsyncMixin::PolledConditions.Add(AsShared());
+		FAsyncMixin::EnsureDeferredWorkTicker();
 	}
 
 	return true;
 }
 
-bool FAsyncCondition::TryToContinue(float)
+void FAsyncCondition::Signal()
+{
+	check(IsInGameThread());
+
+	// Nobody is waiting on us yet, whoever binds will evaluate the condition first.
+	if (CompletionDelegate.IsBound())
+	{
+		TryToContinue();
+	}
+}
+
+bool FAsyncCondition::TryToContinue()
 {
 	QUICK_SCOPE_CYCLE_COUNTER(STAT_FAsyncCondition_TryToContinue);
 
@@ -575,7 +678,8 @@ bool FAsyncCondition::TryToContinue(float)
 		case EAsyncConditionResult::TryAgain:
 			return true;
 		case EAsyncConditionResult::Complete:
-			RepeatHandle.Reset();
+			// Left in PolledConditions, the ticker drops conditions that stopped polling.
+			bPolling = false;
 			UserCondition.Unbind();
 
 			CompletionDelegate.ExecuteIfBound();
@@ -60,10 +60,11 @@ DECLARE_DELEGATE_OneParam(FStreamableHandleDelegate, TSharedPtr<FStreamableHandl
  * NOTE: The FAsyncMixin also makes it safe to pass [this] as a captured input into your lambda, because it handles 
  * unhooking everything if either your owner class is destroyed, or you cancel everything.
  *
- * NOTE: FAsyncMixin doesn't add any additional memory to your class.  Several classes currently handling async loading 
- * internally allocate TSharedPtr<FStreamableHandle> members and tend to hold onto SoftObjectPaths temporary state.  The 
- * FAsyncMixin does all of this internally with a static TMap so that all of the async request memory is stored temporarily
- * and sparsely.
+ * NOTE: FAsyncMixin only adds a pointer to your class.  Several classes currently handling async loading internally
+ * allocate TSharedPtr<FStreamableHandle> members and tend to hold onto SoftObjectPaths temporary state.  The FAsyncMixin
+ * does all of this in a loading state it allocates the first time you load something and keeps for the owner's lifetime,
+ * the async request memory inside of it is released once loading completes, so reused objects (list entries) don't
+ * reallocate it on every load.
  * 
  * NOTE: For debugging and understanding what's going on, you should add -LogCmds="LogAsyncMixin Verbose" to the command line.
  */
@@ -166,7 +167,10 @@ protected:
 	/** Given an array of primary asset ids, it loads all of the bundles referenced by properties of these assets specified in the LoadBundles array. */
 	void AsyncPreloadPrimaryAssetsAndBundles(const TArray<FPrimaryAssetId>& AssetIds, const TArray<FName>& LoadBundles, const FSimpleDelegate& Callback = FSimpleDelegate());
 
-	/** Add a future condition that must be true before we move forward. */
+	/**
+	 * Add a future condition that must be true before we move forward.
+	 * Polled conditions are re-evaluated periodically, signaled ones only when FAsyncCondition::Signal is called.
+	 */
 	void AsyncCondition(TSharedRef<FAsyncCondition> Condition, const FSimpleDelegate& Callback = FSimpleDelegate());
 
 	/**
@@ -197,8 +201,8 @@ protected:
 
 private:
 	/**
-	 * The FLoadingState is what actually is allocated for the FAsyncMixin in a big map so that the FAsyncMixin itself holds no
-	 * no memory, and we dynamically create the FLoadingState only if needed, and destroy it when it's unneeded.
+	 * The FLoadingState is what actually is allocated for the FAsyncMixin.  We create it only if needed and keep it with
+	 * the owner, when it's unneeded we only release the memory of its async steps.
 	 */
 	class FLoadingState : public TSharedFromThis<FLoadingState>
 	{
@@ -212,6 +216,12 @@ private:
 		/** Cancels the async sequence. */
 		void CancelAndDestroy();
 
+		/** The owner is being destroyed, cancel everything and never call back into it. */
+		void DetachOwner();
+
+		/** Frees the async steps, called from the deferred work ticker once a release was requested. */
+		void ReleaseMemory();
+
 		void AsyncLoad(FSoftObjectPath SoftObject, const FSimpleDelegate& DelegateToCall);
 		void AsyncLoad(const TArray<FSoftObjectPath>& SoftObjectPaths, const FSimpleDelegate& DelegateToCall);
 		void AsyncPreloadPrimaryAssetsAndBundles(const TArray<FPrimaryAssetId>& PrimaryAssetIds, const TArray<FName>& LoadBundles, const FSimpleDelegate& DelegateToCall);
@@ -221,7 +231,8 @@ private:
 		bool IsLoadingComplete() const { return !IsLoadingInProgress(); }
 		bool IsLoadingInProgress() const;
 		bool IsLoadingInProgressOrPending() const;
-		bool IsPendingDestroy() const;
+		bool IsPendingDestroy() const { return bReleaseScheduled; }
+		bool IsStartScheduled() const { return bStartScheduled; }
 
 	private:
 		void CancelOnly(bool bDestroying);
@@ -234,8 +245,8 @@ private:
 		void RequestDestroyThisMemory();
 		void CancelDestroyThisMemory(bool bDestroying);
 
-		/** Who owns the loading state?  We need this to call back into the owning mix-in object. */
-		FAsyncMixin& OwnerRef;
+		/** Who owns the loading state?  We need this to call back into the owning mix-in object.  Null once it's destroyed. */
+		FAsyncMixin* Owner;
 
 		/**
 		 * Did we need to pre-load bundles?  If we didn't pre-load bundles (which require you keep the streaming handle 
@@ -280,8 +291,10 @@ private:
 		TArray<TUniquePtr<FAsyncStep>> AsyncSteps;
 		TArray<TUniquePtr<FAsyncStep>> AsyncStepsPendingDestruction;
 
-		FTSTicker::FDelegateHandle StartTimerDelegate;
-		FTSTicker::FDelegateHandle DestroyMemoryDelegate;
+		/** Queued in PendingStarts, we'll start next frame if the user doesn't. */
+		bool bStartScheduled = false;
+		/** Queued in PendingReleases, the async steps are freed next frame unless new work comes in. */
+		bool bReleaseScheduled = false;
 	};
 
 	const FLoadingState& GetLoadingStateConst() const;
@@ -292,8 +305,23 @@ private:
 
 	bool IsLoadingInProgressOrPending() const;
 
+	/** Runs the deferred starts, releases and condition polls of every mix-in, from a single shared ticker. */
+	static bool TickDeferredWork(float DeltaTime);
+	static void EnsureDeferredWorkTicker();
+
 private:
-	static TMap<FAsyncMixin*, TSharedRef<FLoadingState>> Loading;
+	TSharedPtr<FLoadingState> LoadingState;
+
+	/**
+	 * Deferred work queues.  Entries are weak and never removed when canceled, the ticker skips anything that's gone or
+	 * no longer flagged as scheduled.
+	 */
+	static TArray<TWeakPtr<FLoadingState>> PendingStarts;
+	static TArray<TWeakPtr<FLoadingState>> PendingReleases;
+	static TArray<TWeakPtr<FAsyncCondition>> PolledConditions;
+	static FTSTicker::FDelegateHandle DeferredWorkHandle;
+
+	friend FAsyncCondition;
 };
 
 /**
@@ -330,28 +358,48 @@ enum class EAsyncConditionResult : uint8
 	Complete
 };
 
+/** How a waiting condition finds out it may be complete. */
+enum class EAsyncConditionWake : uint8
+{
+	/** Re-evaluated every PollInterval seconds until it completes. */
+	Poll,
+	/** Only re-evaluated when Signal() is called, for conditions that know when their state changes. */
+	Signal
+};
+
 DECLARE_DELEGATE_RetVal(EAsyncConditionResult, FAsyncConditionDelegate);
 
 /**
  * The async condition allows you to have custom reasons to hault the async loading until some condition is met.
  */
-class FAsyncCondition : public TSharedFromThis<FAsyncCondition>
+class ASYNCMIXIN_API FAsyncCondition : public TSharedFromThis<FAsyncCondition>
 {
 public:
-	FAsyncCondition(const FAsyncConditionDelegate& Condition);
-	FAsyncCondition(TFunction<EAsyncConditionResult()>&& Condition);
+	FAsyncCondition(const FAsyncConditionDelegate& Condition, EAsyncConditionWake InWake = EAsyncConditionWake::Poll);
+	FAsyncCondition(TFunction<EAsyncConditionResult()>&& Condition, EAsyncConditionWake InWake = EAsyncConditionWake::Poll);
 	virtual ~FAsyncCondition();
 
+	/** Re-evaluates the condition now, continuing the async sequence waiting on it if it's complete. */
+	void Signal();
+
+	/** Seconds between two evaluations of a polled condition. */
+	static constexpr float PollInterval = 0.16f;
+
 protected:
 	bool IsComplete() const;
 	bool BindCompleteDelegate(const FSimpleDelegate& NewDelegate);
 
 private:
-	bool TryToContinue(float DeltaTime);
+	/** Returns true if the condition still has to be waited on. */
+	bool TryToContinue();
 
-	FTSTicker::FDelegateHandle RepeatHandle;
 	FAsyncConditionDelegate UserCondition;
 	FSimpleDelegate CompletionDelegate;
 
+	EAsyncConditionWake Wake;
+	/** Listed in FAsyncMixin::PolledConditions. */
+	bool bPolling = false;
+	float TimeUntilPoll = 0.0f;
+
 	friend FAsyncMixin;
 };
@@ -28,8 +28,9 @@ public:
 	UPROPERTY(config, EditAnywhere, Category=Display)
 	int32 LoadingScreenZOrder = 10000;
 
-	// How long to hold the loading screen up after other loading finishes (in seconds) to
-	// try to give texture streaming a chance to avoid blurriness
+	// The longest the loading screen is held up after other loading finishes (in seconds) to
+	// give texture streaming a chance to avoid blurriness. It is dismissed earlier once the
+	// pending streaming requests, async loads and shader precompiles drop to the limits below
 	//
 	// Note: This is not normally applied in the editor for iteration time, but can be 
 	// enabled via HoldLoadingScreenAdditionalSecsEvenInEditor
@@ -37,6 +38,37 @@ public:
 		meta=(ForceUnits=s, ConsoleVariable="CommonLoadingScreen.HoldLoadingScreenAdditionalSecs"))
 	float HoldLoadingScreenAdditionalSecs = 2.0f;
 
+	// How many frames the world is rendered behind the loading screen before the streaming queues are trusted
+	UPROPERTY(config, EditAnywhere, Category=Configuration,
+		meta=(ClampMin=0, ConsoleVariable="CommonLoadingScreen.HoldLoadingScreenMinFrames"))
+	int32 HoldLoadingScreenMinFrames = 3;
+
+	// The loading screen can be dismissed once at most this many texture/mesh streaming requests are pending
+	UPROPERTY(config, EditAnywhere, Category=Configuration,
+		meta=(ClampMin=0, ConsoleVariable="CommonLoadingScreen.MaxPendingStreamingRequests"))
+	int32 MaxPendingStreamingRequests = 0;
+
+	// The loading screen can be dismissed once at most this many async packages are loading
+	UPROPERTY(config, EditAnywhere, Category=Configuration,
+		meta=(ClampMin=0, ConsoleVariable="CommonLoadingScreen.MaxPendingAsyncLoads"))
+	int32 MaxPendingAsyncLoads = 0;
+
+	// The loading screen can be dismissed once at most this many shader pipeline cache precompiles remain
+	UPROPERTY(config, EditAnywhere, Category=Configuration,
+		meta=(ClampMin=0, ConsoleVariable="CommonLoadingScreen.MaxPendingShaderPrecompiles"))
+	int32 MaxPendingShaderPrecompiles = 0;
+
+	// Garbage is only collected before dropping the loading screen when used physical memory is above
+	// this many megabytes (0 always collects)
+	UPROPERTY(config, EditAnywhere, Category=Configuration,
+		meta=(ForceUnits=MB, ClampMin=0, ConsoleVariable="CommonLoadingScreen.GarbageCollectMemoryBudgetMB"))
+	int32 GarbageCollectMemoryBudgetMB = 0;
+
+	// Purge the collected garbage in one blocking pass instead of incrementally over the next frames
+	UPROPERTY(config, EditAnywhere, Category=Configuration,
+		meta=(ConsoleVariable="CommonLoadingScreen.FullPurgeBeforeHiding"))
+	bool FullPurgeBeforeHiding = false;
+
 	// The interval in seconds beyond which the loading screen is considered permanently hung (if non-zero).
 	UPROPERTY(config, EditAnywhere, Category=Configuration, meta=(ForceUnits=s))
 	float LoadingScreenHeartbeatHangDuration = 0.0f;
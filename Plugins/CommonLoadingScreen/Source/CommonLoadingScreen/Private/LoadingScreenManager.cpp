@@ -20,6 +20,7 @@
 #include "PreLoadScreen.h"
 #include "PreLoadScreenManager.h"
 
+#include "ContentStreaming.h"
 #include "ShaderPipelineCache.h"
 #include "CommonLoadingScreenSettings.h"
 
@@ -35,7 +36,6 @@ DEFINE_LOG_CATEGORY(LogLoadingScreen);
 
 //@TODO: Why can GetLocalPlayers() have nullptr entries?  Can it really?
 //@TODO: Test with PIE mode set to simulate and decide how much (if any) loading screen action should occur
-//@TODO: Allow other things implementing ILoadingProcessInterface besides GameState/PlayerController (and owned components) to register as interested parties
 //@TODO: ChangeMusicSettings (either here or using the LoadingScreenVisibilityChanged delegate)
 //@TODO: Studio analytics (FireEvent_PIEFinishedLoading / tracking PIE startup time for regressions, either here or using the LoadingScreenVisibilityChanged delegate)
 
@@ -64,6 +64,31 @@ bool ILoadingProcessInterface::ShouldShowLoadingScreen(UObject* TestObject, FStr
 	return false;
 }
 
+namespace
+{
+	ULoadingScreenManager* FindLoadingScreenManager(const UObject* WorldContextObject)
+	{
+		const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+		const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+		return GameInstance ? GameInstance->GetSubsystem<ULoadingScreenManager>() : nullptr;
+	}
+}
+
+void ILoadingProcessInterface::RegisterWithLoadingScreen(UObject* Processor)
+{
+	if (ULoadingScreenManager* LoadingScreenManager = FindLoadingScreenManager(Processor)) { LoadingScreenManager->RegisterLoadingProcessor(Processor); }
+}
+
+void ILoadingProcessInterface::UnregisterFromLoadingScreen(UObject* Processor)
+{
+	if (ULoadingScreenManager* LoadingScreenManager = FindLoadingScreenManager(Processor)) { LoadingScreenManager->UnregisterLoadingProcessor(Processor); }
+}
+
+void ILoadingProcessInterface::NotifyLoadingStateChanged(UObject* Processor)
+{
+	if (ULoadingScreenManager* LoadingScreenManager = FindLoadingScreenManager(Processor)) { LoadingScreenManager->NotifyLoadingProcessorStateChanged(Processor); }
+}
+
 //////////////////////////////////////////////////////////////////////
 
 namespace LoadingScreenCVars
@@ -74,9 +99,51 @@ namespace LoadingScreenCVars
 		TEXT("CommonLoadingScreen.HoldLoadingScreenAdditionalSecs"),
 		HoldLoadingScreenAdditionalSecs,
 		TEXT(
-			"How long to hold the loading screen up after other loading finishes (in seconds) to try to give texture streaming a chance to avoid blurriness"),
+			"The longest the loading screen is held up after other loading finishes (in seconds) while texture streaming, async loads and shader precompiles catch up"),
 		ECVF_Default | ECVF_Preview);
 
+	static int32 HoldLoadingScreenMinFrames = 3;
+	static FAutoConsoleVariableRef CVarHoldLoadingScreenMinFrames(
+		TEXT("CommonLoadingScreen.HoldLoadingScreenMinFrames"),
+		HoldLoadingScreenMinFrames,
+		TEXT("How many frames the world is rendered behind the loading screen before the streaming queues are trusted"),
+		ECVF_Default);
+
+	static int32 MaxPendingStreamingRequests = 0;
+	static FAutoConsoleVariableRef CVarMaxPendingStreamingRequests(
+		TEXT("CommonLoadingScreen.MaxPendingStreamingRequests"),
+		MaxPendingStreamingRequests,
+		TEXT("The loading screen can be dismissed once at most this many texture/mesh streaming requests are pending"),
+		ECVF_Default);
+
+	static int32 MaxPendingAsyncLoads = 0;
+	static FAutoConsoleVariableRef CVarMaxPendingAsyncLoads(
+		TEXT("CommonLoadingScreen.MaxPendingAsyncLoads"),
+		MaxPendingAsyncLoads,
+		TEXT("The loading screen can be dismissed once at most this many async packages are loading"),
+		ECVF_Default);
+
+	static int32 MaxPendingShaderPrecompiles = 0;
+	static FAutoConsoleVariableRef CVarMaxPendingShaderPrecompiles(
+		TEXT("CommonLoadingScreen.MaxPendingShaderPrecompiles"),
+		MaxPendingShaderPrecompiles,
+		TEXT("The loading screen can be dismissed once at most this many shader pipeline cache precompiles remain"),
+		ECVF_Default);
+
+	static int32 GarbageCollectMemoryBudgetMB = 0;
+	static FAutoConsoleVariableRef CVarGarbageCollectMemoryBudgetMB(
+		TEXT("CommonLoadingScreen.GarbageCollectMemoryBudgetMB"),
+		GarbageCollectMemoryBudgetMB,
+		TEXT("Only collect garbage before dropping the loading screen when used physical memory is above this many MB (0 always collects)"),
+		ECVF_Default);
+
+	static bool FullPurgeBeforeHiding = false;
+	static FAutoConsoleVariableRef CVarFullPurgeBeforeHiding(
+		TEXT("CommonLoadingScreen.FullPurgeBeforeHiding"),
+		FullPurgeBeforeHiding,
+		TEXT("When true, garbage collected before dropping the loading screen is purged in one blocking pass instead of incrementally"),
+		ECVF_Default);
+
 	static bool LogLoadingScreenReasonEveryFrame = false;
 	static FAutoConsoleVariableRef CVarLogLoadingScreenReasonEveryFrame(
 		TEXT("CommonLoadingScreen.LogLoadingScreenReasonEveryFrame"),
@@ -190,9 +257,102 @@ TStatId ULoadingScreenManager::GetStatId() const { RETURN_QUICK_DECLARE_CYCLE_ST
 
 UWorld* ULoadingScreenManager::GetTickableGameObjectWorld() const { return GetGameInstance()->GetWorld(); }
 
-void ULoadingScreenManager::RegisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface) { ExternalLoadingProcessors.Add(Interface.GetObject()); }
+void ULoadingScreenManager::RegisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface)
+{
+	UObject* Object = Interface.GetObject();
+	if (Object == nullptr) { return; }
+
+	const bool bAlreadyRegistered = ExternalLoadingProcessors.ContainsByPredicate(
+		[Object](const FRegisteredLoadingProcessor& Entry) { return Entry.Processor.GetObject() == Object; });
+	if (!bAlreadyRegistered)
+	{
+		ExternalLoadingProcessors.Add({TWeakInterfacePtr<ILoadingProcessInterface>(Object), false});
+		bPolledLoadingProcessorsDirty = true;
+	}
+
+	NotifyLoadingProcessorStateChanged(Interface);
+}
+
+void ULoadingScreenManager::UnregisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface)
+{
+	const UObject* Object = Interface.GetObject();
+	const int32 ProcessorIndex = ExternalLoadingProcessors.IndexOfByPredicate(
+		[Object](const FRegisteredLoadingProcessor& Entry) { return Entry.Processor.GetObject() == Object; });
+	if (ProcessorIndex == INDEX_NONE) { return; }
+
+	SetLoadingProcessorBlocking(ProcessorIndex, false);
+	ExternalLoadingProcessors.RemoveAtSwap(ProcessorIndex);
+	bPolledLoadingProcessorsDirty = true;
+}
+
+void ULoadingScreenManager::NotifyLoadingProcessorStateChanged(TScriptInterface<ILoadingProcessInterface> Interface)
+{
+	UObject* Object = Interface.GetObject();
+	const int32 ProcessorIndex = ExternalLoadingProcessors.IndexOfByPredicate(
+		[Object](const FRegisteredLoadingProcessor& Entry) { return Entry.Processor.GetObject() == Object; });
+	if (ProcessorIndex == INDEX_NONE) { return; }
+
+	// The reason is fetched again when it is logged, only the answer is kept here
+	FString UnusedReason;
+	SetLoadingProcessorBlocking(ProcessorIndex, ILoadingProcessInterface::ShouldShowLoadingScreen(Object, UnusedReason));
+}
+
+void ULoadingScreenManager::SetLoadingProcessorBlocking(const int32 ProcessorIndex, const bool bBlocking)
+{
+	FRegisteredLoadingProcessor& Entry = ExternalLoadingProcessors[ProcessorIndex];
+	if (Entry.bBlocking == bBlocking) { return; }
+
+	Entry.bBlocking = bBlocking;
+	NumBlockingLoadingProcessors += bBlocking ? 1 : -1;
+	check(NumBlockingLoadingProcessors >= 0);
+}
+
+void ULoadingScreenManager::PruneStaleLoadingProcessors()
+{
+	for (int32 ProcessorIndex = ExternalLoadingProcessors.Num() - 1; ProcessorIndex >= 0; --ProcessorIndex)
+	{
+		if (!ExternalLoadingProcessors[ProcessorIndex].Processor.IsValid())
+		{
+			SetLoadingProcessorBlocking(ProcessorIndex, false);
+			ExternalLoadingProcessors.RemoveAtSwap(ProcessorIndex);
+			bPolledLoadingProcessorsDirty = true;
+		}
+	}
+}
+
+void ULoadingScreenManager::RefreshPolledLoadingProcessors(AGameStateBase* GameState)
+{
+	// Implementers that never registered are still supported, but they are only searched for again when the game state,
+	// a local player controller or one of their component lists changes
+	TArray<AActor*, TInlineAllocator<4>> ScannedActors;
+	ScannedActors.Add(GameState);
+	for (const ULocalPlayer* LP : GetGameInstance()->GetLocalPlayers())
+	{
+		if ((LP != nullptr) && (LP->PlayerController != nullptr)) { ScannedActors.Add(LP->PlayerController); }
+	}
+
+	uint32 ScanKey = 0;
+	for (const AActor* Actor : ScannedActors) { ScanKey = HashCombine(ScanKey, HashCombine(GetTypeHash(Actor), GetTypeHash(Actor->GetComponents().Num()))); }
+
+	if (!bPolledLoadingProcessorsDirty && (ScanKey == PolledLoadingProcessorsScanKey)) { return; }
+	PolledLoadingProcessorsScanKey = ScanKey;
+	bPolledLoadingProcessorsDirty = false;
+
+	PolledLoadingProcessors.Reset();
+	auto AddIfUnregistered = [this](UObject* Object)
+	{
+		if (Cast<ILoadingProcessInterface>(Object) == nullptr) { return; }
+		const bool bRegistered = ExternalLoadingProcessors.ContainsByPredicate(
+			[Object](const FRegisteredLoadingProcessor& Entry) { return Entry.Processor.GetObject() == Object; });
+		if (!bRegistered) { PolledLoadingProcessors.Add(Object); }
+	};
 
-void ULoadingScreenManager::UnregisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface) { ExternalLoadingProcessors.Remove(Interface.GetObject()); }
+	for (AActor* Actor : ScannedActors)
+	{
+		AddIfUnregistered(Actor);
+		for (UActorComponent* Component : Actor->GetComponents()) { AddIfUnregistered(Component); }
+	}
+}
 
 void ULoadingScreenManager::HandlePreLoadMap(const FWorldContext& WorldContext, const FString& MapName)
 {
@@ -209,18 +369,27 @@ void ULoadingScreenManager::HandlePostLoadMap(UWorld* World) { if ((World != nul
 
 void ULoadingScreenManager::UpdateLoadingScreen()
 {
+	const UCommonLoadingScreenSettings* Settings = GetDefault<UCommonLoadingScreenSettings>();
+	const bool bLogHeartbeatDue = (Settings->LogLoadingScreenHeartbeatInterval > 0.0f) && (TimeUntilNextLogHeartbeatSeconds <= 0.0);
 	bool bLogLoadingScreenStatus = LoadingScreenCVars::LogLoadingScreenReasonEveryFrame;
 
-	if (ShouldShowLoadingScreen())
+	// Only build the reason when something is going to print it
+	const bool bWantReason = bLogLoadingScreenStatus || (bCurrentlyShowingLoadingScreen && bLogHeartbeatDue);
+	bool bShouldShowLoadingScreen = ShouldShowLoadingScreen(bWantReason ? &DebugReasonForShowingOrHidingLoadingScreen : nullptr);
+	if (!bWantReason && (bShouldShowLoadingScreen != bCurrentlyShowingLoadingScreen))
 	{
-		const UCommonLoadingScreenSettings* Settings = GetDefault<UCommonLoadingScreenSettings>();
+		// Showing and hiding log the reason, so evaluate once more with it
+		bShouldShowLoadingScreen = ShouldShowLoadingScreen(&DebugReasonForShowingOrHidingLoadingScreen);
+	}
 
+	if (bShouldShowLoadingScreen)
+	{
 		// If we don't make it to the specified checkpoint in the given time will trigger the hang detector so we can better determine where progress stalled.
 		FThreadHeartBeat::Get().MonitorCheckpointStart(GetFName(), Settings->LoadingScreenHeartbeatHangDuration);
 
 		ShowLoadingScreen();
 
-		if ((Settings->LogLoadingScreenHeartbeatInterval > 0.0f) && (TimeUntilNextLogHeartbeatSeconds <= 0.0))
+		if (bLogHeartbeatDue)
 		{
 			bLogLoadingScreenStatus = true;
 			TimeUntilNextLogHeartbeatSeconds = Settings->LogLoadingScreenHeartbeatInterval;
@@ -240,97 +409,85 @@ void ULoadingScreenManager::UpdateLoadingScreen()
 	}
 }
 
-bool ULoadingScreenManager::CheckForAnyNeedToShowLoadingScreen()
+bool ULoadingScreenManager::CheckForAnyNeedToShowLoadingScreen(FString* OutReason)
 {
-	// Start out with 'unknown' reason in case someone forgets to put a reason when changing this in the future.
-	DebugReasonForShowingOrHidingLoadingScreen = TEXT("Reason for Showing/Hiding LoadingScreen is unknown!");
+	// Reasons are only copied out when asked for, the common case of nothing loading does not touch any string
+	auto ShowBecause = [OutReason](const TCHAR* Reason)
+	{
+		if (OutReason != nullptr) { *OutReason = Reason; }
+		return true;
+	};
 
 	const UGameInstance* LocalGameInstance = GetGameInstance();
 
-	if (LoadingScreenCVars::ForceLoadingScreenVisible)
-	{
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("CommonLoadingScreen.AlwaysShow is true"));
-		return true;
-	}
+	if (LoadingScreenCVars::ForceLoadingScreenVisible) { return ShowBecause(TEXT("CommonLoadingScreen.AlwaysShow is true")); }
 
 	const FWorldContext* Context = LocalGameInstance->GetWorldContext();
 	if (Context == nullptr)
 	{
 		// We don't have a world context right now... better show a loading screen
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("The game instance has a null WorldContext"));
-		return true;
+		return ShowBecause(TEXT("The game instance has a null WorldContext"));
 	}
 
 	UWorld* World = Context->World();
-	if (World == nullptr)
-	{
-		DebugReasonForShowingOrHidingLoadingScreen =
-			FString(TEXT("We have no world (FWorldContext's World() is null)"));
-		return true;
-	}
+	if (World == nullptr) { return ShowBecause(TEXT("We have no world (FWorldContext's World() is null)")); }
 
 	AGameStateBase* GameState = World->GetGameState<AGameStateBase>();
 	if (GameState == nullptr)
 	{
 		// The game state has not yet replicated.
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("GameState hasn't yet replicated (it's null)"));
-		return true;
+		return ShowBecause(TEXT("GameState hasn't yet replicated (it's null)"));
 	}
 
 	if (bCurrentlyInLoadMap)
 	{
 		// Show a loading screen if we are in LoadMap
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("bCurrentlyInLoadMap is true"));
-		return true;
+		return ShowBecause(TEXT("bCurrentlyInLoadMap is true"));
 	}
 
 	if (!Context->TravelURL.IsEmpty())
 	{
 		// Show a loading screen when pending travel
-		DebugReasonForShowingOrHidingLoadingScreen = FString(
-			TEXT("We have pending travel (the TravelURL is not empty)"));
-		return true;
+		return ShowBecause(TEXT("We have pending travel (the TravelURL is not empty)"));
 	}
 
 	if (Context->PendingNetGame != nullptr)
 	{
 		// Connecting to another server
-		DebugReasonForShowingOrHidingLoadingScreen = FString(
-			TEXT("We are connecting to another server (PendingNetGame != nullptr)"));
-		return true;
+		return ShowBecause(TEXT("We are connecting to another server (PendingNetGame != nullptr)"));
 	}
 
-	if (!World->HasBegunPlay())
-	{
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("World hasn't begun play"));
-		return true;
-	}
+	if (!World->HasBegunPlay()) { return ShowBecause(TEXT("World hasn't begun play")); }
 
 	if (World->IsInSeamlessTravel())
 	{
 		// Show a loading screen during seamless travel
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("We are in seamless travel"));
-		return true;
+		return ShowBecause(TEXT("We are in seamless travel"));
 	}
 
-	// Ask the game state if it needs a loading screen	
-	if (ILoadingProcessInterface::ShouldShowLoadingScreen(GameState, /*out*/
-	                                                      DebugReasonForShowingOrHidingLoadingScreen)) { return true; }
-
-	// Ask any game state components if they need a loading screen
-	for (UActorComponent* TestComponent : GameState->GetComponents())
+	// Registered loading processors signal their state changes, so they cost nothing here unless one is blocking.
+	// These might be actors or components that were registered by game code to tell us to keep the loading screen up
+	// while perhaps something finishes streaming in.
+	if (NumBlockingLoadingProcessors > 0) { PruneStaleLoadingProcessors(); }
+	if (NumBlockingLoadingProcessors > 0)
 	{
-		if (ILoadingProcessInterface::ShouldShowLoadingScreen(TestComponent, /*out*/
-		                                                      DebugReasonForShowingOrHidingLoadingScreen)) { return true; }
+		if (OutReason != nullptr)
+		{
+			for (const FRegisteredLoadingProcessor& Entry : ExternalLoadingProcessors)
+			{
+				if (Entry.bBlocking && ILoadingProcessInterface::ShouldShowLoadingScreen(Entry.Processor.GetObject(), /*out*/ *OutReason)) { break; }
+			}
+		}
+		return true;
 	}
 
-	// Ask any of the external loading processors that may have been registered.  These might be actors or components
-	// that were registered by game code to tell us to keep the loading screen up while perhaps something finishes
-	// streaming in.
-	for (const TWeakInterfacePtr<ILoadingProcessInterface>& Processor : ExternalLoadingProcessors)
+	// Ask the game state, the local player controllers and their components that did not register
+	RefreshPolledLoadingProcessors(GameState);
+	FString UnusedReason;
+	for (const TWeakInterfacePtr<ILoadingProcessInterface>& Processor : PolledLoadingProcessors)
 	{
 		if (ILoadingProcessInterface::ShouldShowLoadingScreen(Processor.GetObject(), /*out*/
-		                                                      DebugReasonForShowingOrHidingLoadingScreen)) { return true; }
+		                                                      OutReason != nullptr ? *OutReason : UnusedReason)) { return true; }
 	}
 
 	// Check each local player
@@ -341,21 +498,7 @@ bool ULoadingScreenManager::CheckForAnyNeedToShowLoadingScreen()
 	{
 		if (LP != nullptr)
 		{
-			if (APlayerController* PC = LP->PlayerController)
-			{
-				bFoundAnyLocalPC = true;
-
-				// Ask the PC itself if it needs a loading screen
-				if (ILoadingProcessInterface::ShouldShowLoadingScreen(
-					PC, /*out*/ DebugReasonForShowingOrHidingLoadingScreen)) { return true; }
-
-				// Ask any PC components if they need a loading screen
-				for (UActorComponent* TestComponent : PC->GetComponents())
-				{
-					if (ILoadingProcessInterface::ShouldShowLoadingScreen(
-						TestComponent, /*out*/ DebugReasonForShowingOrHidingLoadingScreen)) { return true; }
-				}
-			}
+			if (LP->PlayerController != nullptr) { bFoundAnyLocalPC = true; }
 			else { bMissingAnyLocalPC = true; }
 		}
 	}
@@ -364,26 +507,17 @@ bool ULoadingScreenManager::CheckForAnyNeedToShowLoadingScreen()
 	const bool bIsInSplitscreen = GameViewportClient->GetCurrentSplitscreenConfiguration() != ESplitScreenType::None;
 
 	// In splitscreen we need all player controllers to be present
-	if (bIsInSplitscreen && bMissingAnyLocalPC)
-	{
-		DebugReasonForShowingOrHidingLoadingScreen = FString(
-			TEXT("At least one missing local player controller in splitscreen"));
-		return true;
-	}
+	if (bIsInSplitscreen && bMissingAnyLocalPC) { return ShowBecause(TEXT("At least one missing local player controller in splitscreen")); }
 
 	// And in non-splitscreen we need at least one player controller to be present
-	if (!bIsInSplitscreen && !bFoundAnyLocalPC)
-	{
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("Need at least one local player controller"));
-		return true;
-	}
+	if (!bIsInSplitscreen && !bFoundAnyLocalPC) { return ShowBecause(TEXT("Need at least one local player controller")); }
 
 	// Victory! The loading screen can go away now
-	DebugReasonForShowingOrHidingLoadingScreen = TEXT("(nothing wants to show it anymore)");
+	ShowBecause(TEXT("(nothing wants to show it anymore)"));
 	return false;
 }
 
-bool ULoadingScreenManager::ShouldShowLoadingScreen()
+bool ULoadingScreenManager::ShouldShowLoadingScreen(FString* OutReason)
 {
 	const UCommonLoadingScreenSettings* Settings = GetDefault<UCommonLoadingScreenSettings>();
 
@@ -392,7 +526,7 @@ bool ULoadingScreenManager::ShouldShowLoadingScreen()
 	static bool bCmdLineNoLoadingScreen = FParse::Param(FCommandLine::Get(), TEXT("NoLoadingScreen"));
 	if (bCmdLineNoLoadingScreen)
 	{
-		DebugReasonForShowingOrHidingLoadingScreen = FString(TEXT("CommandLine has 'NoLoadingScreen'"));
+		if (OutReason != nullptr) { *OutReason = TEXT("CommandLine has 'NoLoadingScreen'"); }
 		return false;
 	}
 #endif
@@ -402,7 +536,7 @@ bool ULoadingScreenManager::ShouldShowLoadingScreen()
 	if (LocalGameInstance->GetGameViewportClient() == nullptr) { return false; }
 
 	// Check for a need to show the loading screen
-	const bool bNeedToShowLoadingScreen = CheckForAnyNeedToShowLoadingScreen();
+	const bool bNeedToShowLoadingScreen = CheckForAnyNeedToShowLoadingScreen(OutReason);
 
 	// Keep the loading screen up a bit longer if desired
 	bool bWantToForceShowLoadingScreen = false;
@@ -411,19 +545,22 @@ bool ULoadingScreenManager::ShouldShowLoadingScreen()
 		// Still need to show it
 		TimeLoadingScreenLastDismissed = -1.0;
 	}
-	else
+	else if (bCurrentlyShowingLoadingScreen)
 	{
-		// Don't *need* to show the screen anymore, but might still want to for a bit
+		// Don't *need* to show the screen anymore, but keep it up until streaming has caught up (at most the hold time)
 		const double CurrentTime = FPlatformTime::Seconds();
 		const bool bCanHoldLoadingScreen = (!GIsEditor || Settings->HoldLoadingScreenAdditionalSecsEvenInEditor);
 		const double HoldLoadingScreenAdditionalSecs = bCanHoldLoadingScreen
 			                                               ? LoadingScreenCVars::HoldLoadingScreenAdditionalSecs
 			                                               : 0.0;
 
-		if (TimeLoadingScreenLastDismissed < 0.0) { TimeLoadingScreenLastDismissed = CurrentTime; }
+		if (TimeLoadingScreenLastDismissed < 0.0)
+		{
+			TimeLoadingScreenLastDismissed = CurrentTime;
+			FrameLoadingScreenLastDismissed = GFrameCounter;
+		}
 		const double TimeSinceScreenDismissed = CurrentTime - TimeLoadingScreenLastDismissed;
 
-		// hold for an extra X seconds, to cover up streaming
 		if ((HoldLoadingScreenAdditionalSecs > 0.0) && (TimeSinceScreenDismissed < HoldLoadingScreenAdditionalSecs))
 		{
 			// Make sure we're rendering the world at this point, so that textures will actually stream in
@@ -431,10 +568,29 @@ bool ULoadingScreenManager::ShouldShowLoadingScreen()
 			UGameViewportClient* GameViewportClient = GetGameInstance()->GetGameViewportClient();
 			GameViewportClient->bDisableWorldRendering = false;
 
-			DebugReasonForShowingOrHidingLoadingScreen = FString::Printf(
-				TEXT("Keeping loading screen up for an additional %.2f seconds to allow texture streaming"),
-				HoldLoadingScreenAdditionalSecs);
-			bWantToForceShowLoadingScreen = true;
+			// The streamers only know what the world wants once it has been rendered for a few frames
+			const bool bSettling = (GFrameCounter - FrameLoadingScreenLastDismissed) < static_cast<uint64>(FMath::Max(LoadingScreenCVars::HoldLoadingScreenMinFrames, 0));
+			const int32 NumPendingStreamingRequests = IStreamingManager::Get().GetNumWantingResources();
+			const int32 NumPendingAsyncLoads = GetNumAsyncPackages();
+			const int32 NumPendingShaderPrecompiles = static_cast<int32>(FShaderPipelineCache::NumPrecompilesRemaining());
+
+			bWantToForceShowLoadingScreen = bSettling
+				|| (NumPendingStreamingRequests > LoadingScreenCVars::MaxPendingStreamingRequests)
+				|| (NumPendingAsyncLoads > LoadingScreenCVars::MaxPendingAsyncLoads)
+				|| (NumPendingShaderPrecompiles > LoadingScreenCVars::MaxPendingShaderPrecompiles);
+
+			if (OutReason != nullptr)
+			{
+				*OutReason = bWantToForceShowLoadingScreen
+					             ? FString::Printf(
+						             TEXT("Keeping loading screen up for at most %.2f more seconds to allow streaming (%d streaming requests, %d async loads, %d shader precompiles pending)"),
+						             HoldLoadingScreenAdditionalSecs - TimeSinceScreenDismissed, NumPendingStreamingRequests,
+						             NumPendingAsyncLoads, NumPendingShaderPrecompiles)
+					             : FString::Printf(
+						             TEXT("Streaming caught up after %.2f seconds (%d streaming requests, %d async loads, %d shader precompiles pending)"),
+						             TimeSinceScreenDismissed, NumPendingStreamingRequests, NumPendingAsyncLoads,
+						             NumPendingShaderPrecompiles);
+			}
 		}
 	}
 
@@ -522,8 +678,19 @@ void ULoadingScreenManager::HideLoadingScreen()
 		UE_LOG(LogLoadingScreen, Log, TEXT("Hiding loading screen when 'IsShowingInitialLoadingScreen()' is false."));
 		UE_LOG(LogLoadingScreen, Log, TEXT("%s"), *DebugReasonForShowingOrHidingLoadingScreen);
 
-		UE_LOG(LogLoadingScreen, Log, TEXT("Garbage Collecting before dropping load screen"));
-		GEngine->ForceGarbageCollection(true);
+		// Only collect when memory is over budget, and let the purge run incrementally behind the game unless asked otherwise
+		const uint64 UsedPhysicalMB = FPlatformMemory::GetStats().UsedPhysical / (1024 * 1024);
+		if ((LoadingScreenCVars::GarbageCollectMemoryBudgetMB > 0) && (UsedPhysicalMB < static_cast<uint64>(LoadingScreenCVars::GarbageCollectMemoryBudgetMB)))
+		{
+			UE_LOG(LogLoadingScreen, Log, TEXT("Skipping garbage collection before dropping load screen (%llu MB used, budget %d MB)"),
+			       UsedPhysicalMB, LoadingScreenCVars::GarbageCollectMemoryBudgetMB);
+		}
+		else
+		{
+			UE_LOG(LogLoadingScreen, Log, TEXT("Garbage Collecting before dropping load screen (full purge: %d)"),
+			       LoadingScreenCVars::FullPurgeBeforeHiding ? 1 : 0);
+			GEngine->ForceGarbageCollection(LoadingScreenCVars::FullPurgeBeforeHiding);
+		}
 
 		RemoveWidgetFromViewport();
 
@@ -23,6 +23,15 @@ public:
 	// be currently showing a loading screen
 	static bool ShouldShowLoadingScreen(UObject* TestObject, FString& OutReason);
 
+	// Registers Processor with the loading screen manager of its game instance (no-op where there is none, e.g. dedicated
+	// servers). Registered processors are queried once now and afterwards only when they call NotifyLoadingStateChanged,
+	// instead of being polled every frame.
+	static void RegisterWithLoadingScreen(UObject* Processor);
+	static void UnregisterFromLoadingScreen(UObject* Processor);
+
+	// Tells the loading screen manager that the result of ShouldShowLoadingScreen may have changed for Processor
+	static void NotifyLoadingStateChanged(UObject* Processor);
+
 	virtual bool ShouldShowLoadingScreen(FString& OutReason) const
 	{
 		return false;
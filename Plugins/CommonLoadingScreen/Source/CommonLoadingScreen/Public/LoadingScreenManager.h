@@ -11,6 +11,7 @@
 template <typename InterfaceType>
 class TScriptInterface;
 
+class AGameStateBase;
 class FSubsystemCollectionBase;
 class IInputProcessor;
 class ILoadingProcessInterface;
@@ -43,6 +44,7 @@ public:
 	virtual UWorld* GetTickableGameObjectWorld() const override;
 	//~End of FTickableObjectBase interface
 
+	/** The reason is only rebuilt when the visibility changes or while it is being logged, so it may be stale otherwise */
 	UFUNCTION(BlueprintCallable, Category=LoadingScreen)
 	FString GetDebugReasonForShowingOrHidingLoadingScreen() const
 	{
@@ -62,9 +64,22 @@ public:
 		return LoadingScreenVisibilityChanged;
 	}
 
+	/**
+	 * Registers a loading processor. It is queried right away and then only again when it calls
+	 * NotifyLoadingProcessorStateChanged, so it has to signal every change of its ShouldShowLoadingScreen result.
+	 */
 	void RegisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface);
 	void UnregisterLoadingProcessor(TScriptInterface<ILoadingProcessInterface> Interface);
 
+	/** Re-queries a registered loading processor and updates the blocker count */
+	void NotifyLoadingProcessorStateChanged(TScriptInterface<ILoadingProcessInterface> Interface);
+
+	/** Returns how many registered loading processors currently want the loading screen up */
+	int32 GetNumBlockingLoadingProcessors() const
+	{
+		return NumBlockingLoadingProcessors;
+	}
+
 private:
 	void HandlePreLoadMap(const FWorldContext& WorldContext, const FString& MapName);
 	void HandlePostLoadMap(UWorld* World);
@@ -72,11 +87,20 @@ private:
 	/** Determines if we should show or hide the loading screen. Called every frame. */
 	void UpdateLoadingScreen();
 
-	/** Returns true if we need to be showing the loading screen. */
-	bool CheckForAnyNeedToShowLoadingScreen();
+	/** Returns true if we need to be showing the loading screen. OutReason is only filled in when not null. */
+	bool CheckForAnyNeedToShowLoadingScreen(FString* OutReason);
 
 	/** Returns true if we want to be showing the loading screen (if we need to or are artificially forcing it on for other reasons). */
-	bool ShouldShowLoadingScreen();
+	bool ShouldShowLoadingScreen(FString* OutReason);
+
+	/** Updates whether a registered processor is blocking, keeping NumBlockingLoadingProcessors in sync */
+	void SetLoadingProcessorBlocking(int32 ProcessorIndex, bool bBlocking);
+
+	/** Drops registered processors that were destroyed without unregistering */
+	void PruneStaleLoadingProcessors();
+
+	/** Rebuilds PolledLoadingProcessors when the game state, the local player controllers or their components changed */
+	void RefreshPolledLoadingProcessors(AGameStateBase* GameState);
 
 	/** Returns true if we are in the initial loading flow before this screen should be used */
 	bool IsShowingInitialLoadingScreen() const;
@@ -107,8 +131,28 @@ private:
 	/** Input processor to eat all input while the loading screen is shown */
 	TSharedPtr<IInputProcessor> InputPreProcessor;
 
-	/** External loading processors, components maybe actors that delay the loading. */
-	TArray<TWeakInterfacePtr<ILoadingProcessInterface>> ExternalLoadingProcessors;
+	struct FRegisteredLoadingProcessor
+	{
+		TWeakInterfacePtr<ILoadingProcessInterface> Processor;
+
+		/** Result of the last ShouldShowLoadingScreen query, refreshed when the processor signals a change */
+		bool bBlocking = false;
+	};
+
+	/** Registered loading processors, components maybe actors that delay the loading. */
+	TArray<FRegisteredLoadingProcessor> ExternalLoadingProcessors;
+
+	/** Number of entries in ExternalLoadingProcessors that are currently blocking */
+	int32 NumBlockingLoadingProcessors = 0;
+
+	/** Implementers on the game state, local player controllers and their components that never registered. Polled every frame. */
+	TArray<TWeakInterfacePtr<ILoadingProcessInterface>> PolledLoadingProcessors;
+
+	/** Hash of the actors and component counts PolledLoadingProcessors was built from */
+	uint32 PolledLoadingProcessorsScanKey = 0;
+
+	/** Set when registrations changed, so the polled list has to be rebuilt even if the scan key did not change */
+	bool bPolledLoadingProcessorsDirty = true;
 
 	/** The reason why the loading screen is up (or not) */
 	FString DebugReasonForShowingOrHidingLoadingScreen;
@@ -119,6 +163,9 @@ private:
 	/** The time the loading screen most recently wanted to be dismissed (might still be up due to a min display duration requirement) **/
 	double TimeLoadingScreenLastDismissed = -1.0;
 
+	/** GFrameCounter when the loading screen most recently wanted to be dismissed */
+	uint64 FrameLoadingScreenLastDismissed = 0;
+
 	/** The time until the next log for why the loading screen is still up */
 	double TimeUntilNextLogHeartbeatSeconds = 0.0;
 
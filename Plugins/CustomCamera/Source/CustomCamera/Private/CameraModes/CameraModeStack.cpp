@@ -6,8 +6,28 @@
 #include "Engine/Canvas.h"
 #include UE_INLINE_GENERATED_CPP_BY_NAME(CameraModeStack)
 
+DECLARE_STATS_GROUP(TEXT("CustomCamera"), STATGROUP_CustomCamera, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Camera Mode Instances"), STAT_CustomCamera_LiveCameraModeInstances, STATGROUP_CustomCamera);
+
+namespace CameraModeStackCvars
+{
+	static int32 MaxCachedCameraModes = 8;
+	static FAutoConsoleVariableRef CVarMaxCachedCameraModes(
+		TEXT("CustomCamera.MaxCachedCameraModes"),
+		MaxCachedCameraModes,
+		TEXT("Maximum number of camera mode instances each camera mode stack keeps alive, not counting modes on the stack."));
+}
+
 UCameraModeStack::UCameraModeStack() { bIsActive = true; }
 
+void UCameraModeStack::BeginDestroy()
+{
+	DEC_DWORD_STAT_BY(STAT_CustomCamera_LiveCameraModeInstances, CameraModeInstances.Num());
+	CameraModeInstances.Reset();
+
+	Super::BeginDestroy();
+}
+
 void UCameraModeStack::ActivateStack()
 {
 	if (bIsActive) return;
@@ -83,7 +103,11 @@ void UCameraModeStack::PushCameraMode(const TSubclassOf<UCustomCameraMode>& Came
 	CameraModeStack.Last()->SetBlendWeight(1.0f);
 
 	// Let the camera mode know if it's being added to the stack.
-	if (ExistingStackIndex == INDEX_NONE) CameraMode->OnActivation();
+	if (ExistingStackIndex == INDEX_NONE)
+	{
+		CameraMode->ResetForReuse();
+		CameraMode->OnActivation();
+	}
 }
 
 bool UCameraModeStack::EvaluateStack(const float DeltaTime, FCameraModeView& OutCameraModeView)
@@ -100,18 +124,53 @@ UCustomCameraMode* UCameraModeStack::GetCameraModeInstance(const TSubclassOf<UCu
 {
 	check(CameraModeClass);
 
-	// First see if we already created one.
-	for (UCustomCameraMode* CameraMode : CameraModeInstances) { if (!CameraMode && CameraMode->GetClass() == CameraModeClass) return CameraMode; }
+	// First see if we already created one, and mark it as most recently used.
+	for (int32 InstanceIndex = CameraModeInstances.Num() - 1; InstanceIndex >= 0; --InstanceIndex)
+	{
+		UCustomCameraMode* CameraMode = CameraModeInstances[InstanceIndex];
+		if (!CameraMode || CameraMode->GetClass() != CameraModeClass) continue;
+
+		if (InstanceIndex != CameraModeInstances.Num() - 1)
+		{
+			CameraModeInstances.RemoveAt(InstanceIndex, 1, EAllowShrinking::No);
+			CameraModeInstances.Add(CameraMode);
+		}
+		return CameraMode;
+	}
 
 	// Not found, so we need to create it.
 	UCustomCameraMode* NewCameraMode = NewObject<UCustomCameraMode>(GetOuter(), CameraModeClass, NAME_None, RF_NoFlags);
 	check(NewCameraMode);
 
 	CameraModeInstances.Add(NewCameraMode);
+	INC_DWORD_STAT(STAT_CustomCamera_LiveCameraModeInstances);
+
+	TrimCameraModeInstances();
 
 	return NewCameraMode;
 }
 
+void UCameraModeStack::TrimCameraModeInstances()
+{
+	int32 NumInactive = 0;
+	for (const UCustomCameraMode* CameraMode : CameraModeInstances) { if (!CameraModeStack.Contains(CameraMode)) ++NumInactive; }
+
+	// The newest instance is about to be pushed, never evict it.
+	const int32 MaxCachedCameraModes = FMath::Max(CameraModeStackCvars::MaxCachedCameraModes, 1);
+	for (int32 InstanceIndex = 0; InstanceIndex < CameraModeInstances.Num() - 1 && NumInactive > MaxCachedCameraModes;)
+	{
+		if (CameraModeStack.Contains(CameraModeInstances[InstanceIndex]))
+		{
+			++InstanceIndex;
+			continue;
+		}
+
+		CameraModeInstances.RemoveAt(InstanceIndex, 1, EAllowShrinking::No);
+		DEC_DWORD_STAT(STAT_CustomCamera_LiveCameraModeInstances);
+		--NumInactive;
+	}
+}
+
 void UCameraModeStack::UpdateStack(const float DeltaTime)
 {
 	const int32 StackSize = CameraModeStack.Num();
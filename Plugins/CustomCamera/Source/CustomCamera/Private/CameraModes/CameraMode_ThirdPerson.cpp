@@ -31,6 +31,23 @@ UCameraMode_ThirdPerson::UCameraMode_ThirdPerson()
 	PenetrationAvoidanceFeelers.Add(FPenetrationAvoidanceFeeler(FRotator(-20.0f, +00.0f, 0.0f), 0.50f, 0.50f, 00.f, 4));
 }
 
+void UCameraMode_ThirdPerson::ResetForReuse()
+{
+	Super::ResetForReuse();
+
+	AimLineToDesiredPosBlockedPct = 0.f;
+	DebugActorsHitDuringCameraPenetration.Reset();
+
+	for (FPenetrationAvoidanceFeeler& Feeler : PenetrationAvoidanceFeelers) { Feeler.FramesUntilNextTrace = 0; }
+	PendingFeelerTraces.Reset();
+	AsyncIgnoredActors.Reset();
+
+	InitialCrouchOffset = FVector::ZeroVector;
+	TargetCrouchOffset = FVector::ZeroVector;
+	CrouchOffsetBlendPct = 1.0f;
+	CurrentCrouchOffset = FVector::ZeroVector;
+}
+
 void UCameraMode_ThirdPerson::UpdateView(const float DeltaTime)
 {
 	UpdateForTarget(DeltaTime);
@@ -185,6 +202,8 @@ void UCameraMode_ThirdPerson::PreventCameraPenetration(const AActor& ViewTarget,
 	UWorld* World = GetWorld();
 	if (!World) return;
 
+	// Decided once per frame, whether the due feelers are swept now, requested async, or both.
+	TBitArray<> FeelersToTrace(false, NumRaysToShoot);
 	for (int32 RayIdx = 0; RayIdx < NumRaysToShoot; ++RayIdx)
 	{
 		FPenetrationAvoidanceFeeler& Feeler = PenetrationAvoidanceFeelers[RayIdx];
@@ -193,13 +212,34 @@ void UCameraMode_ThirdPerson::PreventCameraPenetration(const AActor& ViewTarget,
 			--Feeler.FramesUntilNextTrace;
 			continue;
 		}
-		FVector RayTarget = CalculateRayTarget(SafeLoc, BaseRay, Feeler, BaseRayLocalUp, BaseRayLocalRight);
-		PerformSweep(World, SafeLoc, RayTarget, SphereShape, SphereParams, Feeler, ViewTarget, DistBlockedPctThisFrame);
+		Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
+		FeelersToTrace[RayIdx] = true;
+	}
 
-		if (RayIdx == 0) HardBlockedPct = DistBlockedPctThisFrame;
-		else SoftBlockedPct = DistBlockedPctThisFrame;
+	// Async results are one frame old, so fall back to sync sweeps when snapping the camera or when they aren't available.
+	const bool bUsedAsyncResults = bUseAsyncPenetrationTraces && !bResetInterpolation &&
+		ConsumeAsyncPenetrationTraces(World, SafeLoc, DistBlockedPctThisFrame, HardBlockedPct, SoftBlockedPct);
+
+	if (!bUsedAsyncResults)
+	{
+		// Copy so the actors ignored while sweeping this frame don't leak into the async requests.
+		FCollisionQueryParams SyncSphereParams = SphereParams;
+		for (int32 RayIdx = 0; RayIdx < NumRaysToShoot; ++RayIdx)
+		{
+			if (!FeelersToTrace[RayIdx]) continue;
+
+			FPenetrationAvoidanceFeeler& Feeler = PenetrationAvoidanceFeelers[RayIdx];
+			FVector RayTarget = CalculateRayTarget(SafeLoc, BaseRay, Feeler, BaseRayLocalUp, BaseRayLocalRight);
+			PerformSweep(World, SafeLoc, RayTarget, SphereShape, SyncSphereParams, Feeler, ViewTarget, DistBlockedPctThisFrame);
+
+			if (RayIdx == 0) HardBlockedPct = DistBlockedPctThisFrame;
+			else SoftBlockedPct = DistBlockedPctThisFrame;
+		}
 	}
 
+	if (bUseAsyncPenetrationTraces) RequestAsyncPenetrationTraces(World, SafeLoc, BaseRay, BaseRayLocalUp, BaseRayLocalRight, SphereParams, FeelersToTrace);
+	else PendingFeelerTraces.Reset();
+
 	DistBlockedPct = UpdateDistBlockedPct(DistBlockedPct, DistBlockedPctThisFrame, HardBlockedPct, SoftBlockedPct, DeltaTime);
 	// UpdateCameraLocation
 	if (DistBlockedPct < 1.f - ZERO_ANIMWEIGHT_THRESH) CameraLoc = SafeLoc + (CameraLoc - SafeLoc) * DistBlockedPct;
@@ -231,8 +271,6 @@ void UCameraMode_ThirdPerson::PerformSweep(const UWorld* World,
 	}
 #endif // ENABLE_DRAW_DEBUG
 
-	Feeler.FramesUntilNextTrace = Feeler.TraceInterval;
-
 	if (bHit)
 	{
 		IgnoreHit(Hit, SphereParams, ViewTarget);
@@ -240,6 +278,75 @@ void UCameraMode_ThirdPerson::PerformSweep(const UWorld* World,
 	}
 }
 
+bool UCameraMode_ThirdPerson::ConsumeAsyncPenetrationTraces(UWorld* World, const FVector& SafeLoc, float& DistBlockedPctThisFrame, float& HardBlockedPct, float& SoftBlockedPct)
+{
+	if (PendingFeelerTraces.IsEmpty()) return false;
+
+	// Results are only kept for a frame, anything older than that can't be used.
+	TArray<FTraceDatum, TInlineAllocator<8>> TraceData;
+	TraceData.SetNum(PendingFeelerTraces.Num());
+	bool bHitIgnoredActor = false;
+	for (int32 RayIdx = 0; RayIdx < PendingFeelerTraces.Num(); ++RayIdx)
+	{
+		if (!PendingFeelerTraces[RayIdx].IsValid()) continue;
+		if (!World->QueryTraceData(PendingFeelerTraces[RayIdx], TraceData[RayIdx])) return false;
+		if (FVector::DistSquared(TraceData[RayIdx].Start, SafeLoc) > FMath::Square(AsyncPenetrationTeleportDistance)) return false;
+
+		// A single sweep stops at an actor the sync path would have swept through, so remember it for the next requests
+		for (const FHitResult& Hit : TraceData[RayIdx].OutHits)
+		{
+			const AActor* HitActor = Hit.GetActor();
+			if (!HitActor || !HitActor->ActorHasTag(NAME_IGNORE_CAMERA_COLLISION)) continue;
+
+			AsyncIgnoredActors.AddUnique(HitActor);
+			bHitIgnoredActor = true;
+		}
+	}
+
+	// What lies behind the ignored actor is unknown, so sweep synchronously for this frame
+	if (bHitIgnoredActor) return false;
+
+	for (int32 RayIdx = 0; RayIdx < PendingFeelerTraces.Num(); ++RayIdx)
+	{
+		if (!PendingFeelerTraces[RayIdx].IsValid()) continue;
+
+		const FTraceDatum& Datum = TraceData[RayIdx];
+		for (const FHitResult& Hit : Datum.OutHits)
+		{
+			if (!Hit.bBlockingHit) continue;
+
+			DistBlockedPctThisFrame = UpdateDistBlockedPctThisFrame(Hit, DistBlockedPctThisFrame, Datum.End, Datum.Start);
+		}
+
+		if (RayIdx == 0) HardBlockedPct = DistBlockedPctThisFrame;
+		else SoftBlockedPct = DistBlockedPctThisFrame;
+	}
+
+	PendingFeelerTraces.Reset();
+	return true;
+}
+
+void UCameraMode_ThirdPerson::RequestAsyncPenetrationTraces(UWorld* World, const FVector& SafeLoc, const FVector& BaseRay, const FVector& BaseRayLocalUp, const FVector& BaseRayLocalRight,
+                                                            const FCollisionQueryParams& SphereParams, const TBitArray<>& FeelersToTrace)
+{
+	PendingFeelerTraces.Reset();
+	PendingFeelerTraces.SetNum(FeelersToTrace.Num());
+
+	FCollisionQueryParams AsyncSphereParams = SphereParams;
+	AsyncIgnoredActors.RemoveAll([](const TWeakObjectPtr<const AActor>& Actor) { return !Actor.IsValid(); });
+	for (const TWeakObjectPtr<const AActor>& Actor : AsyncIgnoredActors) { AsyncSphereParams.AddIgnoredActor(Actor.Get()); }
+
+	for (int32 RayIdx = 0; RayIdx < FeelersToTrace.Num(); ++RayIdx)
+	{
+		if (!FeelersToTrace[RayIdx]) continue;
+
+		const FPenetrationAvoidanceFeeler& Feeler = PenetrationAvoidanceFeelers[RayIdx];
+		const FVector RayTarget = CalculateRayTarget(SafeLoc, BaseRay, Feeler, BaseRayLocalUp, BaseRayLocalRight);
+		PendingFeelerTraces[RayIdx] = World->AsyncSweepByChannel(EAsyncTraceType::Single, SafeLoc, RayTarget, FQuat::Identity, ECC_Camera,
+		                                                         FCollisionShape::MakeSphere(Feeler.Extent), AsyncSphereParams);
+	}
+}
+
 void UCameraMode_ThirdPerson::IgnoreHit(const FHitResult& Hit, FCollisionQueryParams& SphereParams, const AActor& ViewTarget) const
 {
 	const AActor* HitActor = Hit.GetActor();
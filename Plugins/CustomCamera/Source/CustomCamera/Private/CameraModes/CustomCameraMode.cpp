@@ -79,10 +79,14 @@ FRotator UCustomCameraMode::GetPivotRotation() const
 	return TargetActor->GetActorRotation();
 }
 
+void UCustomCameraMode::ResetForReuse() { bResetInterpolation = true; }
+
 void UCustomCameraMode::UpdateCameraMode(const float DeltaTime)
 {
 	UpdateView(DeltaTime);
 	UpdateBlending(DeltaTime);
+
+	bResetInterpolation = false;
 }
 
 void UCustomCameraMode::UpdateView(float DeltaTime)
@@ -22,6 +22,10 @@ class UCameraModeStack : public UObject
 public:
 	UCameraModeStack();
 
+	//~UObject interface
+	virtual void BeginDestroy() override;
+	//~End of UObject interface
+
 	void ActivateStack();
 	void DeactivateStack();
 
@@ -39,11 +43,15 @@ public:
 protected:
 	UCustomCameraMode* GetCameraModeInstance(const TSubclassOf<UCustomCameraMode>& CameraModeClass);
 
+	// Drops the least recently used instances that aren't on the stack until the cache is within budget.
+	void TrimCameraModeInstances();
+
 	void UpdateStack(float DeltaTime);
 	void BlendStack(FCameraModeView& OutCameraModeView) const;
 
 	bool bIsActive;
 
+	// One cached instance per camera mode class, least recently used first.
 	UPROPERTY()
 	TArray<TObjectPtr<UCustomCameraMode>> CameraModeInstances;
 
@@ -24,6 +24,8 @@ class UCameraMode_ThirdPerson : public UCustomCameraMode
 public:
 	UCameraMode_ThirdPerson();
 
+	virtual void ResetForReuse() override;
+
 protected:
 	virtual void UpdateView(float DeltaTime) override;
 
@@ -40,6 +42,9 @@ private:
 	FVector CalculateRayTarget(const FVector& SafeLoc, const FVector& BaseRay, const FPenetrationAvoidanceFeeler& Feeler, const FVector& BaseRayLocalUp, const FVector& BaseRayLocalRight) const;
 	void PerformSweep(const UWorld* World, const FVector& SafeLoc, const FVector& RayTarget, FCollisionShape& SphereShape, FCollisionQueryParams& SphereParams, FPenetrationAvoidanceFeeler& Feeler,
 	                  const AActor& ViewTarget, float& DistBlockedPctThisFrame);
+	bool ConsumeAsyncPenetrationTraces(UWorld* World, const FVector& SafeLoc, float& DistBlockedPctThisFrame, float& HardBlockedPct, float& SoftBlockedPct);
+	void RequestAsyncPenetrationTraces(UWorld* World, const FVector& SafeLoc, const FVector& BaseRay, const FVector& BaseRayLocalUp, const FVector& BaseRayLocalRight,
+	                                   const FCollisionQueryParams& SphereParams, const TBitArray<>& FeelersToTrace);
 	void IgnoreHit(const FHitResult& Hit, FCollisionQueryParams& SphereParams, const AActor& ViewTarget) const;
 	bool ShouldIgnoreCameraBlockingVolume(const FHitResult& Hit, const AActor& ViewTarget) const;
 	float UpdateDistBlockedPctThisFrame(const FHitResult& Hit, const float DistBlockedPctThisFrame, const FVector& RayTarget, const FVector& SafeLoc);
@@ -86,6 +91,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Collision")
 	bool bDoPredictiveAvoidance = true;
 
+	/**
+	 * If true, feeler sweeps are issued as async traces at the end of the frame and their results are used on the next frame.
+	 * Feelers are swept independently, so actors hit by one feeler are not ignored by the others on the same frame.
+	 * Actors tagged to ignore camera collision are remembered and left out of later async sweeps.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Collision")
+	bool bUseAsyncPenetrationTraces = false;
+
+	/** If the safe location moves further than this between issuing and consuming async sweeps (e.g. a teleport), sweep synchronously for that frame. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Collision", Meta = (EditCondition = "bUseAsyncPenetrationTraces", ClampMin = "0.0"))
+	float AsyncPenetrationTeleportDistance = 100.f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision")
 	float CollisionPushOutDistance = 2.f;
 
@@ -113,6 +130,13 @@ public:
 	mutable float LastDrawDebugTime = -MAX_FLT;
 #endif
 
+private:
+	// Async sweeps issued last frame, indexed like PenetrationAvoidanceFeelers. Invalid handles were not traced.
+	TArray<FTraceHandle> PendingFeelerTraces;
+
+	// Actors tagged to ignore camera collision that async sweeps ran into, ignored by the following requests.
+	TArray<TWeakObjectPtr<const AActor>> AsyncIgnoredActors;
+
 protected:
 	void SetTargetCrouchOffset(const FVector& NewTargetOffset);
 	void UpdateCrouchOffset(float DeltaTime);
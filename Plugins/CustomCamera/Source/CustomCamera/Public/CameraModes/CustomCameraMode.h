@@ -39,6 +39,9 @@ public:
 	// Called when this camera mode is deactivated on the camera mode stack.
 	virtual void OnDeactivation() {};
 
+	// Called when a cached instance is pushed back onto the camera mode stack, clears state left from its last use.
+	virtual void ResetForReuse();
+
 	void UpdateCameraMode(float DeltaTime);
 
 	float GetBlendTime() const { return BlendTime; }
@@ -0,0 +1,61 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Experience/ExperienceLoadTimeline.h"
+
+#include "Misc/FileHelper.h"
+
+void FExperienceLoadTimeline::Reset()
+{
+	Events.Reset();
+	OriginSeconds = FPlatformTime::Seconds();
+}
+
+int32 FExperienceLoadTimeline::BeginEvent(const FString& Name, const TCHAR* Category, const int32 Lane)
+{
+	if (Events.IsEmpty() && OriginSeconds == 0.0) OriginSeconds = FPlatformTime::Seconds();
+
+	FEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Name = Name;
+	Event.Category = Category;
+	Event.Lane = Lane;
+	Event.StartSeconds = FPlatformTime::Seconds();
+	return Events.Num() - 1;
+}
+
+void FExperienceLoadTimeline::EndEvent(const int32 EventIndex)
+{
+	if (!Events.IsValidIndex(EventIndex) || Events[EventIndex].EndSeconds >= 0.0) return;
+
+	Events[EventIndex].EndSeconds = FPlatformTime::Seconds();
+}
+
+FString FExperienceLoadTimeline::ToChromeTraceJson() const
+{
+	const double NowSeconds = FPlatformTime::Seconds();
+
+	FString Json = TEXT("{\"traceEvents\":[");
+	for (int32 EventIndex = 0; EventIndex < Events.Num(); ++EventIndex)
+	{
+		const FEvent& Event = Events[EventIndex];
+
+		// Events that are still running are written up to now
+		const double EndSeconds = Event.EndSeconds >= 0.0 ? Event.EndSeconds : NowSeconds;
+
+		if (EventIndex > 0) Json += TEXT(",");
+		Json += FString::Printf(
+			TEXT("\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.0f,\"dur\":%.0f,\"pid\":1,\"tid\":%d}"),
+			*Event.Name.ReplaceCharWithEscapedChar(),
+			Event.Category ? Event.Category : TEXT(""),
+			(Event.StartSeconds - OriginSeconds) * 1000000.0,
+			(EndSeconds - Event.StartSeconds) * 1000000.0,
+			Event.Lane);
+	}
+	Json += TEXT("\n]}\n");
+
+	return Json;
+}
+
+bool FExperienceLoadTimeline::SaveChromeTrace(const FString& Filename) const
+{
+	return FFileHelper::SaveStringToFile(ToChromeTraceJson(), *Filename);
+}
@@ -8,6 +8,9 @@
 #include "Experience/DataAsset/ExperienceActionSet_DA.h"
 #include "Experience/DataAsset/ExperienceDefinition_DA.h"
 #include "Log/Log.h"
+#include "Algo/AllOf.h"
+#include "GameFramework/GameStateBase.h"
+#include "Misc/Paths.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 #include "Engine/World.h"
@@ -35,10 +38,57 @@ namespace ConsoleVariables
 		ECVF_Default);
 
 	float GetExperienceLoadDelayDuration() { return FMath::Max(0.0f, ExperienceLoadRandomDelayMin + FMath::FRand() * ExperienceLoadRandomDelayRange); }
+
+	static bool bExecuteActionsEagerly = false;
+	static FAutoConsoleVariableRef CVarExecuteActionsEagerly(
+		TEXT("Experience.ExecuteActionsEagerly"),
+		bExecuteActionsEagerly,
+		TEXT(
+			"If true, the actions of the experience and of each action set are executed as soon as the game feature plugins they depend on are loaded, instead of once every plugin is loaded"),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdDumpLoadTimeline(
+		TEXT("Experience.DumpLoadTimeline"),
+		TEXT("Writes the timings of the last experience load as a Chrome trace (chrome://tracing). Optional argument: output file name"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, const UWorld* World)
+		{
+			const AGameStateBase* GameState = World ? World->GetGameState() : nullptr;
+			const UExperienceManagerComponent* ExperienceComponent = GameState ? GameState->FindComponentByClass<UExperienceManagerComponent>() : nullptr;
+			if (!ExperienceComponent || ExperienceComponent->GetLoadTimeline().IsEmpty())
+			{
+				ULOG_WARNING(LogExperience, "Experience.DumpLoadTimeline: no experience load has been recorded");
+				return;
+			}
+
+			const FString Filename = FPaths::ProfilingDir() / TEXT("Experience") / (Args.Num() > 0
+				                                                                        ? Args[0]
+				                                                                        : FString::Printf(TEXT("ExperienceLoad-%s.json"), *FDateTime::Now().ToString()));
+			if (!ExperienceComponent->GetLoadTimeline().SaveChromeTrace(Filename))
+			{
+				ULOG_ERROR(LogExperience, "Failed to write experience load timeline to %s", *Filename);
+				return;
+			}
+			ULOG_INFO(LogExperience, "Experience load timeline written to %s", *Filename);
+		}));
+
+	static const TCHAR* LexToString(const EExperienceLoadState State)
+	{
+		switch (State)
+		{
+		case EExperienceLoadState::Unloaded: return TEXT("Unloaded");
+		case EExperienceLoadState::ResolvingExperience: return TEXT("ResolvingExperience");
+		case EExperienceLoadState::Loading: return TEXT("Loading");
+		case EExperienceLoadState::LoadingGameFeatures: return TEXT("LoadingGameFeatures");
+		case EExperienceLoadState::LoadingChaosTestingDelay: return TEXT("LoadingChaosTestingDelay");
+		case EExperienceLoadState::ExecutingActions: return TEXT("ExecutingActions");
+		case EExperienceLoadState::Loaded: return TEXT("Loaded");
+		case EExperienceLoadState::Deactivating: return TEXT("Deactivating");
+		default: return TEXT("Unknown");
+		}
+	}
 }
 
 
-//@TODO: Async load the experience definition itself
 //@TODO: Handle failures explicitly (go into a 'completed but failed' state rather than check()-ing)
 //@TODO: Do the action phases at the appropriate times instead of all at once
 //@TODO: Support deactivating an experience and do the unloading actions
@@ -47,6 +97,9 @@ namespace ConsoleVariables
 // (for a client moving from experience to experience we actually want to diff the requirements and only unload some, not unload everything for them to just be immediately reloaded)
 //@TODO: Handle both built-in and URL-based plugins (search for colon?)
 
+FOnExperienceLoaded UExperienceManagerComponent::OnAnyExperienceBundlesLoaded;
+FOnExperienceLoaded UExperienceManagerComponent::OnAnyExperienceLoaded;
+
 // Sets default values for this component's properties
 UExperienceManagerComponent::UExperienceManagerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer) { SetIsReplicatedByDefault(true); }
@@ -62,9 +115,40 @@ void UExperienceManagerComponent::SetCurrentExperience(const FPrimaryAssetId& Ex
 {
 	const UBaseAssetManager& AssetManager = UBaseAssetManager::Get();
 	check(AssetManager.IsInitialized());
+	check(CurrentExperience == nullptr);
+	check(LoadState == EExperienceLoadState::Unloaded);
 
 	const FSoftObjectPath AssetPath = AssetManager.GetPrimaryAssetPath(ExperienceId);
-	const TSubclassOf<UExperienceDefinition_DA> AssetClass = Cast<UClass>(AssetPath.TryLoad());
+
+	LOG_INFO(LogExperience, "EXPERIENCE: SetCurrentExperience(ExperienceId = %s, %s)",
+	         *ExperienceId.ToString(),
+	         *GetClientServerContext(this));
+
+	SetLoadState(EExperienceLoadState::ResolvingExperience);
+
+	// Resolve the definition class without blocking the game thread on a cold cache
+	const TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		AssetPath, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority, false, false,
+		TEXT("SetCurrentExperience()"));
+
+	const FStreamableDelegate OnResolvedDelegate = FStreamableDelegate::CreateUObject(
+		this, &ThisClass::OnExperienceResolved, AssetPath);
+
+	// Class was already loaded, call the delegate now
+	if (!Handle.IsValid() || Handle->HasLoadCompleted()) FStreamableHandle::ExecuteDelegate(OnResolvedDelegate);
+	else
+	{
+		ExperienceLoadHandle = Handle;
+		Handle->BindCompleteDelegate(OnResolvedDelegate);
+	}
+}
+
+void UExperienceManagerComponent::OnExperienceResolved(FSoftObjectPath AssetPath)
+{
+	check(LoadState == EExperienceLoadState::ResolvingExperience);
+	ExperienceLoadHandle.Reset();
+
+	const TSubclassOf<UExperienceDefinition_DA> AssetClass = Cast<UClass>(AssetPath.ResolveObject());
 	check(AssetClass);
 	const UExperienceDefinition_DA* ExperienceDef = GetDefault<UExperienceDefinition_DA>(AssetClass);
 
@@ -77,13 +161,13 @@ void UExperienceManagerComponent::SetCurrentExperience(const FPrimaryAssetId& Ex
 void UExperienceManagerComponent::StartExperienceLoad()
 {
 	check(CurrentExperience != nullptr);
-	check(LoadState == EExperienceLoadState::Unloaded);
+	check(LoadState == EExperienceLoadState::Unloaded || LoadState == EExperienceLoadState::ResolvingExperience);
 
 	LOG_INFO(LogExperience, "EXPERIENCE: StartExperienceLoad(CurrentExperience = %s, %s)",
 	         *CurrentExperience->GetPrimaryAssetId().ToString(),
 	         *GetClientServerContext(this));
 
-	LoadState = EExperienceLoadState::Loading;
+	SetLoadState(EExperienceLoadState::Loading);
 
 	const TSet<FSoftObjectPath> RawAssetList;
 	const TSet<FPrimaryAssetId> BundleAssetList = PrepareAssetLists();
@@ -99,13 +183,48 @@ void UExperienceManagerComponent::StartExperienceLoad()
 	if (!Handle.IsValid() || Handle->HasLoadCompleted()) FStreamableHandle::ExecuteDelegate(OnAssetsLoadedDelegate);
 	else
 	{
+		ExperienceLoadHandle = Handle;
 		Handle->BindCompleteDelegate(OnAssetsLoadedDelegate);
 		Handle->BindCancelDelegate(FStreamableDelegate::CreateLambda([OnAssetsLoadedDelegate](){ auto _ = OnAssetsLoadedDelegate.ExecuteIfBound(); }));
+		Handle->BindUpdateDelegate(FStreamableUpdateDelegate::CreateUObject(this, &ThisClass::OnExperienceBundlesLoadUpdate));
 	}
 
 	PreloadAssets(BundlesToLoad);
 }
 
+void UExperienceManagerComponent::OnExperienceBundlesLoadUpdate(TSharedRef<FStreamableHandle> Handle)
+{
+	if (LoadState == EExperienceLoadState::Loading) SetLoadStageProgress(Handle->GetProgress());
+}
+
+void UExperienceManagerComponent::SetLoadState(const EExperienceLoadState NewState)
+{
+	// A new load starts from resolving on the server and from the bundle load on clients
+	if (NewState == EExperienceLoadState::ResolvingExperience ||
+		(NewState == EExperienceLoadState::Loading && LoadState == EExperienceLoadState::Unloaded))
+	{
+		LoadTimeline.Reset();
+		PluginTimelineEvents.Reset();
+		LoadStageTimelineEvent = INDEX_NONE;
+	}
+
+	LoadTimeline.EndEvent(LoadStageTimelineEvent);
+	LoadStageTimelineEvent = NewState != EExperienceLoadState::Loaded && NewState != EExperienceLoadState::Unloaded
+		                         ? LoadTimeline.BeginEvent(ConsoleVariables::LexToString(NewState), TEXT("Stage"))
+		                         : INDEX_NONE;
+
+	LoadState = NewState;
+	LoadStageProgress = NewState == EExperienceLoadState::Loaded ? 1.0f : 0.0f;
+	OnExperienceLoadProgress.Broadcast(LoadState, LoadStageProgress);
+	ILoadingProcessInterface::NotifyLoadingStateChanged(this);
+}
+
+void UExperienceManagerComponent::SetLoadStageProgress(const float Progress)
+{
+	LoadStageProgress = Progress;
+	OnExperienceLoadProgress.Broadcast(LoadState, LoadStageProgress);
+}
+
 
 TSet<FPrimaryAssetId> UExperienceManagerComponent::PrepareAssetLists() const
 {
@@ -195,22 +314,22 @@ void UExperienceManagerComponent::OnExperienceLoadComplete()
 	check(LoadState == EExperienceLoadState::Loading);
 	check(CurrentExperience != nullptr);
 
+	ExperienceLoadHandle.Reset();
+	SetLoadStageProgress(1.0f);
+
 	ULOG_INFO(LogExperience, "EXPERIENCE: OnExperienceLoadComplete(CurrentExperience =  %s, %s)",
 	          *CurrentExperience->GetPrimaryAssetId().ToString(),
 	          *GetClientServerContext(this));
 
+	OnAnyExperienceBundlesLoaded.Broadcast(CurrentExperience);
+
 	// find the URLs for our GameFeaturePlugins - filtering out dupes and ones that don't have a valid mapping
+	CollectActionListPluginURLs();
+
 	GameFeaturePluginURLs.Reset();
+	for (const TArray<FString>& PluginURLs : ActionListPluginURLs) GameFeaturePluginURLs.Append(PluginURLs);
 
-	GameFeaturePluginURLs.Append(
-		CollectGameFeaturePluginURLs(CurrentExperience, CurrentExperience->GameFeaturesToEnableList));
-
-	for (const TObjectPtr<UExperienceActionSet_DA>& ActionSet : CurrentExperience->ExperienceActionSets)
-	{
-		if (!ActionSet) continue;
-
-		GameFeaturePluginURLs.Append(CollectGameFeaturePluginURLs(ActionSet, ActionSet->GameFeaturesToEnableList));
-	}
+	LoadedGameFeaturePluginURLs.Reset();
 
 	// Load and activate the features
 	NumGameFeaturePluginsLoading = GameFeaturePluginURLs.Num();
@@ -220,19 +339,37 @@ void UExperienceManagerComponent::OnExperienceLoadComplete()
 		return;
 	}
 
-	LoadState = EExperienceLoadState::LoadingGameFeatures;
-	for (const FString& PluginURL : GameFeaturePluginURLs)
+	SetLoadState(EExperienceLoadState::LoadingGameFeatures);
+	for (int32 PluginIndex = 0; PluginIndex < GameFeaturePluginURLs.Num(); ++PluginIndex)
 	{
+		const FString& PluginURL = GameFeaturePluginURLs[PluginIndex];
 		if (PluginURL.IsEmpty()) continue;
 
+		PluginTimelineEvents.Add(PluginURL, LoadTimeline.BeginEvent(FPaths::GetBaseFilename(PluginURL), TEXT("GameFeaturePlugin"),
+		                                                            FExperienceLoadTimeline::MainLane + 1 + PluginIndex));
+
 		UExperienceManagerSubsystem::NotifyOfPluginActivation(PluginURL);
 		UGameFeaturesSubsystem::Get().LoadAndActivateGameFeaturePlugin(PluginURL,
 		                                                               FGameFeaturePluginLoadComplete::CreateUObject(this,
-		                                                                                                             &ThisClass::OnGameFeaturePluginLoadComplete)
+		                                                                                                             &ThisClass::OnGameFeaturePluginLoadComplete,
+		                                                                                                             PluginURL)
 		);
 	}
 }
 
+void UExperienceManagerComponent::CollectActionListPluginURLs()
+{
+	ActionListPluginURLs.Reset();
+	ActionListPluginURLs.Add(CollectGameFeaturePluginURLs(CurrentExperience, CurrentExperience->GameFeaturesToEnableList));
+
+	for (const TObjectPtr<UExperienceActionSet_DA>& ActionSet : CurrentExperience->ExperienceActionSets)
+	{
+		ActionListPluginURLs.Add(ActionSet ? CollectGameFeaturePluginURLs(ActionSet, ActionSet->GameFeaturesToEnableList) : TArray<FString>());
+	}
+
+	ExecutedActionLists.Init(false, ActionListPluginURLs.Num());
+}
+
 TArray<FString> UExperienceManagerComponent::CollectGameFeaturePluginURLs(
 	const UPrimaryDataAsset* Context, const TArray<FString>& FeaturePluginList) const
 {
@@ -266,12 +403,40 @@ TArray<FString> UExperienceManagerComponent::CollectGameFeaturePluginURLs(
 	return PluginURLs;
 }
 
-void UExperienceManagerComponent::OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result)
+void UExperienceManagerComponent::OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result, FString PluginURL)
 {
+	if (const int32* TimelineEvent = PluginTimelineEvents.Find(PluginURL)) LoadTimeline.EndEvent(*TimelineEvent);
+	LoadedGameFeaturePluginURLs.Add(PluginURL);
+
+	// The experience may have been torn down while this plugin was still loading
+	if (LoadState != EExperienceLoadState::LoadingGameFeatures) return;
+
 	// decrement the number of plugins that are loading
 	NumGameFeaturePluginsLoading--;
+	SetLoadStageProgress(1.0f - static_cast<float>(NumGameFeaturePluginsLoading) / GameFeaturePluginURLs.Num());
 
-	if (NumGameFeaturePluginsLoading == 0) OnExperienceFullLoadCompleted();
+	if (NumGameFeaturePluginsLoading == 0)
+	{
+		OnExperienceFullLoadCompleted();
+		return;
+	}
+
+	if (ConsoleVariables::bExecuteActionsEagerly) ExecuteReadyActionLists();
+}
+
+void UExperienceManagerComponent::ExecuteReadyActionLists()
+{
+	for (int32 ListIndex = 0; ListIndex < ActionListPluginURLs.Num(); ++ListIndex)
+	{
+		if (ExecutedActionLists[ListIndex]) continue;
+
+		auto IsPluginLoaded = [this](const FString& PluginURL) { return LoadedGameFeaturePluginURLs.Contains(PluginURL); };
+
+		// Action sets may rely on anything the experience enables, so they wait for the experience's plugins as well as their own
+		const bool bPluginsReady = Algo::AllOf(ActionListPluginURLs[0], IsPluginLoaded) &&
+			Algo::AllOf(ActionListPluginURLs[ListIndex], IsPluginLoaded);
+		if (bPluginsReady) ExecuteActionList(ListIndex);
+	}
 }
 
 
@@ -283,10 +448,10 @@ void UExperienceManagerComponent::OnExperienceFullLoadCompleted()
 	const float DelaySecs = ConsoleVariables::GetExperienceLoadDelayDuration();
 	InsertRandomDelayForTesting(DelaySecs);
 
-	LoadState = EExperienceLoadState::ExecutingActions;
+	SetLoadState(EExperienceLoadState::ExecutingActions);
 	ExecuteActions();
 
-	LoadState = EExperienceLoadState::Loaded;
+	SetLoadState(EExperienceLoadState::Loaded);
 	BroadcastExperienceLoaded();
 
 	// Apply any necessary scalability settings
@@ -299,40 +464,65 @@ void UExperienceManagerComponent::InsertRandomDelayForTesting(const float DelayS
 
 	FTimerHandle DummyHandle;
 
-	LoadState = EExperienceLoadState::LoadingChaosTestingDelay;
+	SetLoadState(EExperienceLoadState::LoadingChaosTestingDelay);
 	GetWorld()->GetTimerManager().SetTimer(DummyHandle, this, &ThisClass::OnExperienceFullLoadCompleted,
 	                                       DelaySecs, /*bLooping=*/ false);
 }
 
-void UExperienceManagerComponent::ExecuteActions() const
+void UExperienceManagerComponent::ExecuteActions()
 {
+	// Execute whatever wasn't already executed eagerly, in the same order
+	for (int32 ListIndex = 0; ListIndex < ExecutedActionLists.Num(); ++ListIndex)
+	{
+		if (!ExecutedActionLists[ListIndex]) ExecuteActionList(ListIndex);
+	}
+}
+
+void UExperienceManagerComponent::ExecuteActionList(const int32 ListIndex)
+{
+	ExecutedActionLists[ListIndex] = true;
+
+	const TArray<TObjectPtr<UGameFeatureAction>>* ActionList = GetActionList(ListIndex);
+	if (!ActionList) return;
+
+	const UObject* ListOwner = ListIndex == 0 ? static_cast<const UObject*>(CurrentExperience) : CurrentExperience->ExperienceActionSets[ListIndex - 1].Get();
+	const int32 TimelineEvent = LoadTimeline.BeginEvent(GetNameSafe(ListOwner), TEXT("ActionList"));
+
 	FGameFeatureActivatingContext Context;
 
 	const auto ExistingWorldContext = GEngine->GetWorldContextFromWorld(GetWorld());
 	if (ExistingWorldContext) Context.SetRequiredWorldContextHandle(ExistingWorldContext->ContextHandle);
 
-	ActivateListOfActions(CurrentExperience->GameFeatureActions, Context);
-	for (const TObjectPtr<UExperienceActionSet_DA>& ActionSet : CurrentExperience->ExperienceActionSets)
-	{
-		if (!ActionSet) continue;
+	ActivateListOfActions(*ActionList, Context);
 
-		ActivateListOfActions(ActionSet->GameFeatureActions, Context);
-	}
+	LoadTimeline.EndEvent(TimelineEvent);
+}
+
+const TArray<TObjectPtr<UGameFeatureAction>>* UExperienceManagerComponent::GetActionList(const int32 ListIndex) const
+{
+	if (ListIndex == 0) return &CurrentExperience->GameFeatureActions;
+
+	const UExperienceActionSet_DA* ActionSet = CurrentExperience->ExperienceActionSets[ListIndex - 1];
+	return ActionSet ? &ActionSet->GameFeatureActions : nullptr;
 }
 
 void UExperienceManagerComponent::ActivateListOfActions(const TArray<UGameFeatureAction*>& ActionList,
-                                                        FGameFeatureActivatingContext& Context) const
+                                                        FGameFeatureActivatingContext& Context)
 {
 	for (UGameFeatureAction* Action : ActionList)
 	{
 		if (!Action) continue;
 
+		const int32 TimelineEvent = LoadTimeline.BeginEvent(Action->GetClass()->GetName(), TEXT("GameFeatureAction"));
+
 		//@TODO: The fact that these don't take a world are potentially problematic in client-server PIE
 		// The current behavior matches systems like gameplay tags where loading and registering apply to the entire process,
 		// but actually applying the results to actors is restricted to a specific world
 		Action->OnGameFeatureRegistering();
 		Action->OnGameFeatureLoading();
 		Action->OnGameFeatureActivating(Context);
+
+		LoadTimeline.EndEvent(TimelineEvent);
 	}
 }
 
@@ -346,6 +536,8 @@ void UExperienceManagerComponent::BroadcastExperienceLoaded()
 
 	OnExperienceLoaded_LowPriority.Broadcast(CurrentExperience);
 	OnExperienceLoaded_LowPriority.Clear();
+
+	OnAnyExperienceLoaded.Broadcast(CurrentExperience);
 }
 
 void UExperienceManagerComponent::ApplyScalabilitySettings()
@@ -409,9 +601,26 @@ void UExperienceManagerComponent::OnActionDeactivationCompleted()
 	if (NumObservedPausers == NumExpectedPausers) OnAllActionsDeactivated();
 }
 
+void UExperienceManagerComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// The loading screen only re-queries us when the load state changes
+	ILoadingProcessInterface::RegisterWithLoadingScreen(this);
+}
+
 void UExperienceManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
+	ILoadingProcessInterface::UnregisterFromLoadingScreen(this);
+
+	if (LoadState == EExperienceLoadState::ResolvingExperience)
+	{
+		// The definition never resolved, so there is nothing to deactivate
+		if (ExperienceLoadHandle.IsValid()) ExperienceLoadHandle->CancelHandle();
+		ExperienceLoadHandle.Reset();
+		SetLoadState(EExperienceLoadState::Unloaded);
+	}
 
 	DeactivateLoadedFeatures();
 	HandlePartiallyLoadedState();
@@ -429,10 +638,15 @@ void UExperienceManagerComponent::DeactivateLoadedFeatures()
 
 void UExperienceManagerComponent::HandlePartiallyLoadedState()
 {
-	//@TODO: Ensure proper handling of a partially-loaded state too
-	if (LoadState != EExperienceLoadState::Loaded) return;
+	// Actions may have been executed eagerly before the experience finished loading, so deactivate whatever ran
+	if (!CurrentExperience || !ExecutedActionLists.Contains(true))
+	{
+		// Nothing ran yet, stop any pending plugin loads from executing actions after we are gone
+		if (LoadState != EExperienceLoadState::Loaded && LoadState != EExperienceLoadState::Unloaded) SetLoadState(EExperienceLoadState::Unloaded);
+		return;
+	}
 
-	LoadState = EExperienceLoadState::Deactivating;
+	SetLoadState(EExperienceLoadState::Deactivating);
 	NumExpectedPausers = INDEX_NONE;
 	NumObservedPausers = 0;
 
@@ -441,14 +655,13 @@ void UExperienceManagerComponent::HandlePartiallyLoadedState()
 
 	if (const FWorldContext* ExistingWorldContext = GEngine->GetWorldContextFromWorld(GetWorld())) Context.SetRequiredWorldContextHandle(ExistingWorldContext->ContextHandle);
 
-	DeactivateListOfActions(CurrentExperience->GameFeatureActions, Context);
-
-	for (const TObjectPtr<UExperienceActionSet_DA>& ActionSet : CurrentExperience->ExperienceActionSets)
+	for (int32 ListIndex = 0; ListIndex < ExecutedActionLists.Num(); ++ListIndex)
 	{
-		if (!ActionSet) continue;
+		if (!ExecutedActionLists[ListIndex]) continue;
 
-		DeactivateListOfActions(ActionSet->GameFeatureActions, Context);
+		if (const TArray<TObjectPtr<UGameFeatureAction>>* ActionList = GetActionList(ListIndex)) DeactivateListOfActions(*ActionList, Context);
 	}
+	ExecutedActionLists.Init(false, ExecutedActionLists.Num());
 
 	NumExpectedPausers = Context.GetNumPausers();
 
@@ -475,7 +688,7 @@ void UExperienceManagerComponent::DeactivateListOfActions(const TArray<UGameFeat
 void UExperienceManagerComponent::OnAllActionsDeactivated()
 {
 	//@TODO: We actually only deactivated and didn't fully unload...
-	LoadState = EExperienceLoadState::Unloaded;
+	SetLoadState(EExperienceLoadState::Unloaded);
 	CurrentExperience = nullptr;
 	//@TODO:	GEngine->ForceGarbageCollection(true);
 }
@@ -485,6 +698,15 @@ bool UExperienceManagerComponent::ShouldShowLoadingScreen(FString& OutReason) co
 {
 	if (LoadState == EExperienceLoadState::Loaded) return false;
 
-	OutReason = TEXT("Experience still loading");
+	switch (LoadState)
+	{
+	case EExperienceLoadState::ResolvingExperience: OutReason = TEXT("Experience definition still loading");
+		break;
+	case EExperienceLoadState::LoadingGameFeatures: OutReason = FString::Printf(
+			TEXT("Experience game features still loading (%d remaining)"), NumGameFeaturePluginsLoading);
+		break;
+	default: OutReason = TEXT("Experience still loading");
+		break;
+	}
 	return true;
 }
\ No newline at end of file
@@ -186,11 +186,24 @@ void ABaseGameMode::OnExperienceLoaded(const UExperienceDefinition_DA* CurrentEx
 	// Spawn any players that are already attached
 	//@TODO: Here we're handling only *player* controllers, but in GetDefaultPawnClassForController_Implementation we skipped all controllers
 	// GetDefaultPawnClassForController_Implementation might only be getting called for players anyways
+	TArray<AController*> ControllersToRestart;
 	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
 	{
 		APlayerController* PC = Cast<APlayerController>(*Iterator);
-		if (PC && !PC->GetPawn() && PlayerCanRestart(PC)) RestartPlayer(PC);
+		if (PC && !PC->GetPawn() && PlayerCanRestart(PC)) ControllersToRestart.Add(PC);
 	}
+	RestartControllers(ControllersToRestart);
+}
+
+void ABaseGameMode::RestartControllers(const TConstArrayView<AController*> Controllers)
+{
+	const auto PlayerSpawningComponent = GameState->FindComponentByClass<UPlayerSpawningManagerComponent>();
+	if (PlayerSpawningComponent) PlayerSpawningComponent->BeginPlayerStartBatch();
+
+	// Each restart still goes through FindPlayerStart, so FindPlayerStart/ChoosePlayerStart overrides apply
+	for (AController* Controller : Controllers) RestartPlayer(Controller);
+
+	if (PlayerSpawningComponent) PlayerSpawningComponent->EndPlayerStartBatch();
 }
 
 bool ABaseGameMode::IsExperienceLoaded() const
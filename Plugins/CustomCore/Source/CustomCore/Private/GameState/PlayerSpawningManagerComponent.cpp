@@ -8,11 +8,38 @@
 #include "GameFramework/PlayerState.h"
 #include "Interface/IPlayerSpawnInterface.h"
 #include "GameFramework/Controller.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/Pawn.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(PlayerSpawningManagerComponent)
 
 DEFINE_LOG_CATEGORY_STATIC(LogPlayerSpawning, Log, All);
 
+namespace PlayerSpawningCvars
+{
+	static float GridCellSize = 1000.f;
+	static FAutoConsoleVariableRef CVarGridCellSize(
+		TEXT("CustomCore.PlayerSpawn.GridCellSize"),
+		GridCellSize,
+		TEXT("Cell size of the player start spawn grid, read when the spawning manager initializes. ")
+		TEXT("Should exceed the distance at which a pawn can affect a start's occupancy."),
+		ECVF_Default);
+
+	static float OccupancyCacheLifetime = 1.f;
+	static FAutoConsoleVariableRef CVarOccupancyCacheLifetime(
+		TEXT("CustomCore.PlayerSpawn.OccupancyCacheLifetime"),
+		OccupancyCacheLifetime,
+		TEXT("Seconds a cached player start occupancy stays valid without nearby pawn activity. 0 disables the cache."),
+		ECVF_Default);
+
+	static float PawnMoveThreshold = 25.f;
+	static FAutoConsoleVariableRef CVarPawnMoveThreshold(
+		TEXT("CustomCore.PlayerSpawn.PawnMoveThreshold"),
+		PawnMoveThreshold,
+		TEXT("Distance a tracked pawn must move before the occupancy of nearby starts is invalidated."),
+		ECVF_Default);
+}
+
 UPlayerSpawningManagerComponent::UPlayerSpawningManagerComponent(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -36,10 +63,42 @@ void UPlayerSpawningManagerComponent::InitializeComponent()
 	check(World);
 	World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::HandleOnActorSpawned));
 
+	SpawnGridCellSize = FMath::Max(PlayerSpawningCvars::GridCellSize, 100.f);
+
 	for (TActorIterator<APlayerStart> It(World); It; ++It)
 	{
-		if (APlayerStart* PlayerStart = *It) { CachedPlayerStarts.Add(PlayerStart); }
+		if (APlayerStart* PlayerStart = *It) { AddPlayerStart(PlayerStart); }
+	}
+
+	for (TActorIterator<APawn> It(World); It; ++It) { TrackPawn(*It); }
+}
+
+void UPlayerSpawningManagerComponent::TickComponent(const float DeltaTime, const ELevelTick TickType,
+                                                    FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Pawns moving, dying or being destroyed near a start invalidate its cached occupancy
+	const float MoveThresholdSquared = FMath::Square(PlayerSpawningCvars::PawnMoveThreshold);
+	for (auto It = TrackedPawns.CreateIterator(); It; ++It)
+	{
+		const APawn* Pawn = It->Key.Get();
+		if (!Pawn)
+		{
+			InvalidateOccupancyAround(It->Value);
+			It.RemoveCurrent();
+			continue;
+		}
+
+		const FVector Location = Pawn->GetActorLocation();
+		if (FVector::DistSquared(Location, It->Value) < MoveThresholdSquared) continue;
+
+		if (GetSpawnCell(Location) != GetSpawnCell(It->Value)) InvalidateOccupancyAround(It->Value);
+		InvalidateOccupancyAround(Location);
+		It->Value = Location;
 	}
+
+	if (TrackedPawns.IsEmpty()) SetComponentTickEnabled(false);
 }
 
 void UPlayerSpawningManagerComponent::OnLevelAdded(ULevel* InLevel, UWorld* InWorld)
@@ -50,16 +109,131 @@ void UPlayerSpawningManagerComponent::OnLevelAdded(ULevel* InLevel, UWorld* InWo
 		{
 			if (APlayerStart* PlayerStart = Cast<APlayerStart>(Actor))
 			{
-				ensure(!CachedPlayerStarts.Contains(PlayerStart));
-				CachedPlayerStarts.Add(PlayerStart);
+				ensure(!SpawnEntryIndices.Contains(PlayerStart));
+				AddPlayerStart(PlayerStart);
 			}
+			else if (APawn* Pawn = Cast<APawn>(Actor)) { TrackPawn(Pawn); }
 		}
 	}
 }
 
 void UPlayerSpawningManagerComponent::HandleOnActorSpawned(AActor* SpawnedActor)
 {
-	if (APlayerStart* PlayerStart = Cast<APlayerStart>(SpawnedActor)) { CachedPlayerStarts.Add(PlayerStart); }
+	if (APlayerStart* PlayerStart = Cast<APlayerStart>(SpawnedActor)) { AddPlayerStart(PlayerStart); }
+	else if (APawn* Pawn = Cast<APawn>(SpawnedActor)) { TrackPawn(Pawn); }
+}
+
+void UPlayerSpawningManagerComponent::AddPlayerStart(APlayerStart* PlayerStart)
+{
+	if (SpawnEntryIndices.Contains(PlayerStart)) { return; }
+
+	const int32 EntryIndex = SpawnEntries.AddDefaulted();
+	FPlayerStartSpawnEntry& Entry = SpawnEntries[EntryIndex];
+	Entry.PlayerStart = PlayerStart;
+	Entry.Cell = GetSpawnCell(PlayerStart->GetActorLocation());
+
+	SpawnEntryIndices.Add(PlayerStart, EntryIndex);
+	SpawnGrid.FindOrAdd(Entry.Cell).Entries.Add(EntryIndex);
+	bPlayerStartListDirty = true;
+}
+
+void UPlayerSpawningManagerComponent::CompactPlayerStarts()
+{
+	SpawnEntries.RemoveAll([](const FPlayerStartSpawnEntry& Entry) { return !Entry.PlayerStart.IsValid(); });
+
+	// Indices shifted: rebuild the lookups, keeping cell generations so cached occupancy stays valid
+	SpawnEntryIndices.Reset();
+	for (auto& Pair : SpawnGrid) { Pair.Value.Entries.Reset(); }
+	for (int32 EntryIndex = 0; EntryIndex < SpawnEntries.Num(); ++EntryIndex)
+	{
+		const FPlayerStartSpawnEntry& Entry = SpawnEntries[EntryIndex];
+		SpawnEntryIndices.Add(Entry.PlayerStart.Get(), EntryIndex);
+		SpawnGrid.FindOrAdd(Entry.Cell).Entries.Add(EntryIndex);
+	}
+
+	bPlayerStartListDirty = true;
+}
+
+const TArray<APlayerStart*>& UPlayerSpawningManagerComponent::GetCachedPlayerStarts()
+{
+	for (const FPlayerStartSpawnEntry& Entry : SpawnEntries)
+	{
+		if (!Entry.PlayerStart.IsValid())
+		{
+			CompactPlayerStarts();
+			break;
+		}
+	}
+
+	if (bPlayerStartListDirty)
+	{
+		CachedPlayerStartList.Reset(SpawnEntries.Num());
+		for (const FPlayerStartSpawnEntry& Entry : SpawnEntries) { CachedPlayerStartList.Add(Entry.PlayerStart.Get()); }
+		bPlayerStartListDirty = false;
+	}
+
+	return CachedPlayerStartList;
+}
+
+void UPlayerSpawningManagerComponent::TrackPawn(APawn* Pawn)
+{
+	// Spawn decisions are made on the server only
+	if (!Pawn || GetWorld()->GetNetMode() == NM_Client) { return; }
+
+	const FVector Location = Pawn->GetActorLocation();
+	TrackedPawns.Add(Pawn, Location);
+	InvalidateOccupancyAround(Location);
+	SetComponentTickEnabled(true);
+}
+
+FIntPoint UPlayerSpawningManagerComponent::GetSpawnCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / SpawnGridCellSize),
+	                 FMath::FloorToInt32(Location.Y / SpawnGridCellSize));
+}
+
+void UPlayerSpawningManagerComponent::InvalidateOccupancyAround(const FVector& Location)
+{
+	const FIntPoint Center = GetSpawnCell(Location);
+	for (int32 OffsetX = -1; OffsetX <= 1; ++OffsetX)
+	{
+		for (int32 OffsetY = -1; OffsetY <= 1; ++OffsetY)
+		{
+			if (FPlayerStartSpawnCell* Cell = SpawnGrid.Find(Center + FIntPoint(OffsetX, OffsetY))) { ++Cell->Generation; }
+		}
+	}
+}
+
+EPlayerStartLocationOccupancy UPlayerSpawningManagerComponent::GetPlayerStartOccupancy(
+	APlayerStart* PlayerStart, AController* Controller) const
+{
+	IPlayerSpawnInterface* SpawnInterface = Cast<IPlayerSpawnInterface>(PlayerStart);
+	if (!SpawnInterface) { return EPlayerStartLocationOccupancy::Full; }
+
+	const int32* EntryIndex = SpawnEntryIndices.Find(PlayerStart);
+	const UWorld* World = GetWorld();
+	const AGameModeBase* GameMode = World ? World->GetAuthGameMode() : nullptr;
+	if (!EntryIndex || !GameMode || PlayerSpawningCvars::OccupancyCacheLifetime <= 0.f)
+	{
+		return SpawnInterface->GetLocationOccupancy(Controller);
+	}
+
+	// Occupancy depends on the pawn that has to fit, so a cached result only holds for the same pawn class
+	const FPlayerStartSpawnEntry& Entry = SpawnEntries[*EntryIndex];
+	const FPlayerStartSpawnCell& Cell = SpawnGrid.FindChecked(Entry.Cell);
+	const UClass* PawnClass = GameMode->GetDefaultPawnClassForController(Controller);
+	const double Now = World->GetTimeSeconds();
+
+	if (Entry.EvaluatedTime < 0.0 || Entry.CellGeneration != Cell.Generation || Entry.EvaluatedPawnClass.Get() != PawnClass
+		|| Now - Entry.EvaluatedTime > PlayerSpawningCvars::OccupancyCacheLifetime)
+	{
+		Entry.Occupancy = SpawnInterface->GetLocationOccupancy(Controller);
+		Entry.CellGeneration = Cell.Generation;
+		Entry.EvaluatedTime = Now;
+		Entry.EvaluatedPawnClass = const_cast<UClass*>(PawnClass);
+	}
+
+	return Entry.Occupancy;
 }
 
 // ABaseGameMode Proxied Calls - Need to handle when someone chooses
@@ -67,6 +241,20 @@ void UPlayerSpawningManagerComponent::HandleOnActorSpawned(AActor* SpawnedActor)
 //======================================================================
 
 AActor* UPlayerSpawningManagerComponent::ChoosePlayerStart(AController* Player)
+{
+	return ChoosePlayerStartInternal(Player, BatchTakenStarts.GetPtrOrNull());
+}
+
+void UPlayerSpawningManagerComponent::BeginPlayerStartBatch()
+{
+	ensure(!BatchTakenStarts.IsSet());
+	BatchTakenStarts.Emplace();
+}
+
+void UPlayerSpawningManagerComponent::EndPlayerStartBatch() { BatchTakenStarts.Reset(); }
+
+AActor* UPlayerSpawningManagerComponent::ChoosePlayerStartInternal(AController* Player,
+                                                                   TSet<const APlayerStart*>* TakenStarts)
 {
 	if (!Player) { return nullptr; }
 
@@ -74,17 +262,7 @@ AActor* UPlayerSpawningManagerComponent::ChoosePlayerStart(AController* Player)
 	if (APlayerStart* PlayerStart = FindPlayFromHereStart(Player)) { return PlayerStart; }
 #endif
 
-	TArray<APlayerStart*> StarterPoints;
-	for (auto StartIt = CachedPlayerStarts.CreateIterator(); StartIt; ++StartIt)
-	{
-		if (APlayerStart* Start = StartIt->Get())
-		{
-			StarterPoints.Add(Start);
-			continue;
-		}
-
-		StartIt.RemoveCurrent();
-	}
+	const TArray<APlayerStart*>& StarterPoints = GetCachedPlayerStarts();
 
 	if (const APlayerState* PlayerState = Player->GetPlayerState<APlayerState>())
 	{
@@ -97,13 +275,19 @@ AActor* UPlayerSpawningManagerComponent::ChoosePlayerStart(AController* Player)
 		}
 	}
 
-	AActor* PlayerStart = OnChoosePlayerStart(Player, StarterPoints);
+	// Overrides get their own copy so they cannot corrupt the cached list
+	TArray<APlayerStart*> CandidateStarts = StarterPoints;
+	AActor* PlayerStart = OnChoosePlayerStart(Player, CandidateStarts);
 
-	if (!PlayerStart) { PlayerStart = GetFirstRandomUnoccupiedPlayerStart(Player, StarterPoints); }
+	if (!PlayerStart) { PlayerStart = PickRandomPlayerStart(Player, StarterPoints, TakenStarts); }
 
 
 	if (const auto BaseStart = Cast<IPlayerSpawnInterface>(PlayerStart)) { BaseStart->TryClaim(Player); }
 
+	if (TakenStarts)
+	{
+		if (const APlayerStart* ChosenStart = Cast<APlayerStart>(PlayerStart)) { TakenStarts->Add(ChosenStart); }
+	}
 
 	// if (APlayerStart* BaseStart = Cast<APlayerStart>(PlayerStart))
 	// 	BaseStart->TryClaim(Player);
@@ -155,36 +339,43 @@ void UPlayerSpawningManagerComponent::FinishRestartPlayer(AController* NewPlayer
 
 APlayerStart* UPlayerSpawningManagerComponent::GetFirstRandomUnoccupiedPlayerStart(
 	AController* Controller, const TArray<APlayerStart*>& FoundStartPoints) const
+{
+	return PickRandomPlayerStart(Controller, FoundStartPoints, nullptr);
+}
+
+APlayerStart* UPlayerSpawningManagerComponent::PickRandomPlayerStart(
+	AController* Controller, const TArray<APlayerStart*>& FoundStartPoints,
+	const TSet<const APlayerStart*>* TakenStarts) const
 {
 	if (!Controller) { return nullptr; }
 
-	TArray<APlayerStart*> UnOccupiedStartPoints;
-	TArray<APlayerStart*> OccupiedStartPoints;
+	// Uniform pick per occupancy class without collecting candidates (reservoir sampling).
+	// A start already taken by this batch counts as partially occupied.
+	APlayerStart* UnOccupiedStartPoint = nullptr;
+	APlayerStart* OccupiedStartPoint = nullptr;
+	int32 NumUnOccupied = 0;
+	int32 NumOccupied = 0;
 
 	for (APlayerStart* StartPoint : FoundStartPoints)
 	{
-		//const EPlayerStartLocationOccupancy State = StartPoint->GetLocationOccupancy(Controller);
+		if (!StartPoint) { continue; }
 
-		EPlayerStartLocationOccupancy State = EPlayerStartLocationOccupancy::Full;
-		if (const auto BaseStart = Cast<IPlayerSpawnInterface>(StartPoint))
+		EPlayerStartLocationOccupancy State = GetPlayerStartOccupancy(StartPoint, Controller);
+		if (State == EPlayerStartLocationOccupancy::Empty && TakenStarts && TakenStarts->Contains(StartPoint))
 		{
-			State = BaseStart->GetLocationOccupancy(Controller);
+			State = EPlayerStartLocationOccupancy::Partial;
 		}
 
-		if (State == EPlayerStartLocationOccupancy::Empty) { UnOccupiedStartPoints.Add(StartPoint); }
-
-		if (State == EPlayerStartLocationOccupancy::Partial) { OccupiedStartPoints.Add(StartPoint); }
-	}
-
-	if (UnOccupiedStartPoints.Num() > 0)
-	{
-		return UnOccupiedStartPoints[FMath::RandRange(0, UnOccupiedStartPoints.Num() - 1)];
-	}
+		if (State == EPlayerStartLocationOccupancy::Empty && FMath::RandRange(0, NumUnOccupied++) == 0)
+		{
+			UnOccupiedStartPoint = StartPoint;
+		}
 
-	if (OccupiedStartPoints.Num() > 0)
-	{
-		return OccupiedStartPoints[FMath::RandRange(0, OccupiedStartPoints.Num() - 1)];
+		if (State == EPlayerStartLocationOccupancy::Partial && FMath::RandRange(0, NumOccupied++) == 0)
+		{
+			OccupiedStartPoint = StartPoint;
+		}
 	}
 
-	return nullptr;
+	return UnOccupiedStartPoint ? UnOccupiedStartPoint : OccupiedStartPoint;
 }
@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Records how long each phase of an experience load took (stages, game feature plugins and actions)
+ * and writes it out in the Chrome trace event format, viewable in chrome://tracing or Perfetto.
+ */
+struct CUSTOMCORE_API FExperienceLoadTimeline
+{
+	// Lane used for load stages and actions, plugins each get their own lane so their loads can overlap
+	static constexpr int32 MainLane = 0;
+
+	void Reset();
+
+	// Starts a new event and returns its index, to be passed to EndEvent
+	int32 BeginEvent(const FString& Name, const TCHAR* Category, int32 Lane = MainLane);
+	void EndEvent(int32 EventIndex);
+
+	bool IsEmpty() const { return Events.IsEmpty(); }
+
+	FString ToChromeTraceJson() const;
+	bool SaveChromeTrace(const FString& Filename) const;
+
+private:
+	struct FEvent
+	{
+		FString Name;
+		const TCHAR* Category = nullptr;
+		int32 Lane = MainLane;
+		double StartSeconds = 0.0;
+		double EndSeconds = -1.0;
+	};
+
+	TArray<FEvent> Events;
+	double OriginSeconds = 0.0;
+};
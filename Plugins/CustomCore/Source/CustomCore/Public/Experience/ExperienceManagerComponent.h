@@ -3,6 +3,7 @@
 #pragma once
 #include "LoadingProcessInterface.h"
 #include "Components/GameStateComponent.h"
+#include "Experience/ExperienceLoadTimeline.h"
 #include "ExperienceManagerComponent.generated.h"
 
 struct FStreamableHandle;
@@ -15,6 +16,7 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnExperienceLoaded, const UExperienceDefini
 enum class EExperienceLoadState
 {
 	Unloaded,
+	ResolvingExperience,
 	Loading,
 	LoadingGameFeatures,
 	LoadingChaosTestingDelay,
@@ -23,6 +25,8 @@ enum class EExperienceLoadState
 	Deactivating
 };
 
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnExperienceLoadProgress, EExperienceLoadState /*Stage*/, float /*StageProgress*/);
+
 namespace UE::GameFeatures
 {
 	struct FResult;
@@ -38,6 +42,7 @@ public:
 
 
 	//~UActorComponent interface
+	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~End of UActorComponent interface
 
@@ -68,7 +73,32 @@ public:
 	// Returns true if the experience is fully loaded
 	FORCEINLINE bool IsExperienceLoaded() const { return LoadState == EExperienceLoadState::Loaded && CurrentExperience; }
 
+	EExperienceLoadState GetLoadState() const { return LoadState; }
+
+	// Progress of the current load stage, from 0 to 1
+	float GetLoadStageProgress() const { return LoadStageProgress; }
+
+	/** Delegate called when the experience load enters a new stage or makes progress within one */
+	FOnExperienceLoadProgress OnExperienceLoadProgress;
+
+	// Timings of every stage, game feature plugin and action of the most recent experience load
+	const FExperienceLoadTimeline& GetLoadTimeline() const { return LoadTimeline; }
+
+	/**
+	 * Called by every experience manager once the bundles of its experience are loaded, before its game features load
+	 * and its actions run. Lets systems outside of the experience (e.g. the gameplay cue manager) prepare ahead of gameplay.
+	 */
+	static FOnExperienceLoaded OnAnyExperienceBundlesLoaded;
+
+	/** Called by every experience manager once its experience is fully loaded, after its own delegates */
+	static FOnExperienceLoaded OnAnyExperienceLoaded;
+
 private:
+	void SetLoadState(EExperienceLoadState NewState);
+	void SetLoadStageProgress(float Progress);
+	void OnExperienceResolved(FSoftObjectPath AssetPath);
+	void OnExperienceBundlesLoadUpdate(TSharedRef<FStreamableHandle> Handle);
+
 	TSharedPtr<FStreamableHandle> CreateStreamableHandle(const TSet<FPrimaryAssetId>& BundleAssetList,
 	                                                     const TSet<FSoftObjectPath>& RawAssetList,
 	                                                     const TArray<FName>& BundlesToLoad) const;
@@ -79,8 +109,11 @@ private:
 	void OnExperienceLoadComplete();
 	TArray<FString> CollectGameFeaturePluginURLs(const UPrimaryDataAsset* Context,
 	                                             const TArray<FString>& FeaturePluginList) const;
-	void OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result);
-	void ExecuteActions() const;
+	void OnGameFeaturePluginLoadComplete(const UE::GameFeatures::FResult& Result, FString PluginURL);
+	void CollectActionListPluginURLs();
+	void ExecuteReadyActionLists();
+	void ExecuteActions();
+	void ExecuteActionList(int32 ListIndex);
 	void BroadcastExperienceLoaded();
 	void ApplyScalabilitySettings();
 	void OnExperienceFullLoadCompleted();
@@ -88,8 +121,10 @@ private:
 
 	void OnActionDeactivationCompleted();
 	void OnAllActionsDeactivated();
-	void ActivateListOfActions(const TArray<UGameFeatureAction*>& ActionList, FGameFeatureActivatingContext& Context) const;
+	void ActivateListOfActions(const TArray<UGameFeatureAction*>& ActionList, FGameFeatureActivatingContext& Context);
 
+	// Actions of the list at ListIndex, index 0 is the experience itself and the rest follow ExperienceActionSets
+	const TArray<TObjectPtr<UGameFeatureAction>>* GetActionList(int32 ListIndex) const;
 	void DeactivateListOfActions(const TArray<UGameFeatureAction*>& ActionList, FGameFeatureDeactivatingContext& Context) const;
 	void DeactivateLoadedFeatures();
 	void HandlePartiallyLoadedState();
@@ -100,9 +135,22 @@ private:
 	TObjectPtr<const UExperienceDefinition_DA> CurrentExperience;
 
 	EExperienceLoadState LoadState = EExperienceLoadState::Unloaded;
+	float LoadStageProgress = 0.0f;
+
+	// In-flight load of the experience definition class, then of its bundles
+	TSharedPtr<FStreamableHandle> ExperienceLoadHandle;
 
 	int32 NumGameFeaturePluginsLoading = 0;
 	TArray<FString> GameFeaturePluginURLs;
+	TSet<FString> LoadedGameFeaturePluginURLs;
+
+	// Plugins each action list waits for, index 0 is the experience itself and the rest follow ExperienceActionSets
+	TArray<TArray<FString>> ActionListPluginURLs;
+	TBitArray<> ExecutedActionLists;
+
+	FExperienceLoadTimeline LoadTimeline;
+	int32 LoadStageTimelineEvent = INDEX_NONE;
+	TMap<FString, int32> PluginTimelineEvents;
 
 	int32 NumObservedPausers = 0;
 	int32 NumExpectedPausers = 0;
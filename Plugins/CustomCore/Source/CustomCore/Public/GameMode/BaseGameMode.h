@@ -63,6 +63,9 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void RequestPlayerRestartNextFrame(AController* Controller, bool bForceReset = false);
 
+	// Restart several players or bots at once (e.g. round restarts); their starts are assigned in one batch
+	void RestartControllers(TConstArrayView<AController*> Controllers);
+
 	// Agnostic version of PlayerCanRestart that can be used for both player bots and players
 	virtual bool ControllerCanRestart(AController* Controller);
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/GameStateComponent.h"
+#include "UObject/ObjectKey.h"
 #include "PlayerSpawningManagerComponent.generated.h"
 
 enum class EPlayerStartLocationOccupancy
@@ -14,7 +15,27 @@ enum class EPlayerStartLocationOccupancy
 };
 
 class APlayerStart;
+class APawn;
 
+/** A player start in the spawn index, with its last evaluated occupancy */
+struct FPlayerStartSpawnEntry
+{
+	TWeakObjectPtr<APlayerStart> PlayerStart;
+	FIntPoint Cell = FIntPoint::ZeroValue;
+
+	/** Occupancy cache; valid while the cell generation, pawn class and lifetime all still match */
+	mutable EPlayerStartLocationOccupancy Occupancy = EPlayerStartLocationOccupancy::Full;
+	mutable uint32 CellGeneration = 0;
+	mutable double EvaluatedTime = -1.0;
+	mutable TWeakObjectPtr<UClass> EvaluatedPawnClass;
+};
+
+/** Starts of one spawn grid cell. Generation is bumped whenever a pawn moves, spawns or disappears near the cell */
+struct FPlayerStartSpawnCell
+{
+	TArray<int32, TInlineAllocator<4>> Entries;
+	uint32 Generation = 1;
+};
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
 class CUSTOMCORE_API UPlayerSpawningManagerComponent : public UGameStateComponent
@@ -25,12 +46,25 @@ public:
 	// Sets default values for this component's properties
 	UPlayerSpawningManagerComponent(const FObjectInitializer& ObjectInitializer);
 	virtual void InitializeComponent() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
+	                           FActorComponentTickFunction* ThisTickFunction) override;
+
+	/**
+	 * Starts chosen between BeginPlayerStartBatch and EndPlayerStartBatch (round restarts) are remembered,
+	 * so an unoccupied start is handed out at most once per batch while others remain.
+	 */
+	void BeginPlayerStartBatch();
+	void EndPlayerStartBatch();
 
 protected:
 	// Utility
 	APlayerStart* GetFirstRandomUnoccupiedPlayerStart(AController* Controller,
 	                                                  const TArray<APlayerStart*>& FoundStartPoints) const;
 
+	/** Occupancy of a start for Controller, from the spawn index cache when still valid */
+	EPlayerStartLocationOccupancy GetPlayerStartOccupancy(APlayerStart* PlayerStart, AController* Controller) const;
+
+	/** PlayerStarts is a copy of the live starts, so overrides may filter or reorder it freely */
 	virtual AActor* OnChoosePlayerStart(AController* Player, TArray<APlayerStart*>& PlayerStarts) { return nullptr; }
 
 	virtual void OnFinishRestartPlayer(AController* Player, const FRotator& StartRotation);
@@ -46,13 +80,40 @@ private:
 	friend class ABaseGameMode;
 	/** ~ABaseGameMode */
 
-	UPROPERTY(Transient)
-	TArray<TWeakObjectPtr<APlayerStart>> CachedPlayerStarts;
+	AActor* ChoosePlayerStartInternal(AController* Player, TSet<const APlayerStart*>* TakenStarts);
+	APlayerStart* PickRandomPlayerStart(AController* Controller, const TArray<APlayerStart*>& FoundStartPoints,
+	                                    const TSet<const APlayerStart*>* TakenStarts) const;
+
+	/** Live starts, rebuilt only when starts are added or destroyed */
+	const TArray<APlayerStart*>& GetCachedPlayerStarts();
+
+	void AddPlayerStart(APlayerStart* PlayerStart);
+	/** Drops destroyed starts and rebuilds the grid */
+	void CompactPlayerStarts();
+
+	void TrackPawn(APawn* Pawn);
+	FIntPoint GetSpawnCell(const FVector& Location) const;
+	/** Invalidates cached occupancy of every start in the 3x3 cells around Location */
+	void InvalidateOccupancyAround(const FVector& Location);
+
+	TArray<FPlayerStartSpawnEntry> SpawnEntries;
+	TMap<TObjectKey<APlayerStart>, int32> SpawnEntryIndices;
+	TMap<FIntPoint, FPlayerStartSpawnCell> SpawnGrid;
+	float SpawnGridCellSize = 1000.f;
+
+	TArray<APlayerStart*> CachedPlayerStartList;
+	bool bPlayerStartListDirty = true;
+
+	/** Starts handed out by the current batch, unset outside of one */
+	TOptional<TSet<const APlayerStart*>> BatchTakenStarts;
+
+	/** Pawns near which start occupancy may change, with the location their last invalidation used */
+	TMap<TWeakObjectPtr<APawn>, FVector> TrackedPawns;
 
 	void OnLevelAdded(ULevel* InLevel, UWorld* InWorld);
 	void HandleOnActorSpawned(AActor* SpawnedActor);
 
 #if WITH_EDITOR
 	APlayerStart* FindPlayFromHereStart(const AController* Player) const;
-#endif                         FActorComponentTickFunction* ThisTickFunction) override;
+#endif
 };
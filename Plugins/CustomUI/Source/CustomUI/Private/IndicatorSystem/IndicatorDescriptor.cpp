@@ -152,6 +152,64 @@ bool FIndicatorProjection::ProjectBoundingBox(const UIndicatorDescriptor& Indica
 	return true;
 }
 
+bool FIndicatorProjection::GetProjectionAnchor(const UIndicatorDescriptor& IndicatorDescriptor,
+                                               FVector& OutWorldAnchor) const
+{
+	const USceneComponent* Component = IndicatorDescriptor.GetSceneComponent();
+	if (!Component) { return false; }
+
+	const EActorCanvasProjectionMode ProjectionMode = IndicatorDescriptor.GetProjectionMode();
+	switch (ProjectionMode)
+	{
+	case EActorCanvasProjectionMode::ComponentPoint:
+		{
+			TOptional<FVector> WorldLocation = GetWorldLocation(IndicatorDescriptor, Component);
+			if (!WorldLocation.IsSet()) { return false; }
+
+			OutWorldAnchor = WorldLocation.GetValue() + IndicatorDescriptor.GetWorldPositionOffset();
+			return true;
+		}
+	case EActorCanvasProjectionMode::ActorBoundingBox:
+	case EActorCanvasProjectionMode::ComponentBoundingBox:
+		{
+			const FBox IndicatorBox = (ProjectionMode == EActorCanvasProjectionMode::ActorBoundingBox)
+				                          ? Component->GetOwner()->GetComponentsBoundingBox()
+				                          : Component->Bounds.GetBox();
+
+			OutWorldAnchor = IndicatorBox.GetCenter() + (IndicatorBox.GetSize() * (IndicatorDescriptor.
+				GetBoundingBoxAnchor() - FVector(0.5)));
+			return true;
+		}
+	default:
+		return false;
+	}
+}
+
+bool FIndicatorProjection::ProjectClipPosition(const UIndicatorDescriptor& IndicatorDescriptor,
+                                               const FVector4& ClipPosition, const FVector2f& ScreenSize,
+                                               FVector2D& OutScreenPosition)
+{
+	// Same as ULocalPlayer::GetPixelPoint, with the view projection matrix applied by the caller
+	const bool bInFrontOfCamera = ClipPosition.W > 0.0;
+	double W = FMath::Abs(ClipPosition.W);
+	if (W < UE_KINDA_SMALL_NUMBER) { W = UE_KINDA_SMALL_NUMBER; }
+
+	const double InvW = 1.0 / W;
+	OutScreenPosition = FVector2D((0.5 + ClipPosition.X * 0.5 * InvW) * ScreenSize.X,
+	                              (0.5 - ClipPosition.Y * 0.5 * InvW) * ScreenSize.Y);
+
+	OutScreenPosition.X += IndicatorDescriptor.GetScreenSpaceOffset().X * (bInFrontOfCamera ? 1 : -1);
+	OutScreenPosition.Y += IndicatorDescriptor.GetScreenSpaceOffset().Y;
+
+	if (!bInFrontOfCamera && FBox2f(FVector2f::Zero(), ScreenSize).IsInside(static_cast<FVector2f>(OutScreenPosition)))
+	{
+		const FVector2f CenterToPosition = (FVector2f(OutScreenPosition) - (ScreenSize / 2)).GetSafeNormal();
+		OutScreenPosition = FVector2D((ScreenSize / 2) + CenterToPosition * ScreenSize);
+	}
+
+	return bInFrontOfCamera;
+}
+
 // bool FIndicatorProjection::Project(const UIndicatorDescriptor& IndicatorDescriptor,
 //                                    const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize,
 //                                    FVector& OutScreenPositionWithDepth)
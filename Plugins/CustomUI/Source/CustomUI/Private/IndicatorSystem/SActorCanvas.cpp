@@ -3,6 +3,7 @@
 #include "IndicatorSystem/SActorCanvas.h"
 
 #include "Engine/GameViewportClient.h"
+#include "HAL/IConsoleManager.h"
 #include "IndicatorSystem/IActorIndicatorWidget.h"
 #include "Layout/ArrangedChildren.h"
 #include "IndicatorSystem/LyraIndicatorManagerComponent.h"
@@ -13,6 +14,23 @@
 
 class FSlateRect;
 
+namespace ActorCanvasCVars
+{
+	static float FarDistance = 5000.0f;
+	static FAutoConsoleVariableRef CVarFarDistance(
+		TEXT("Indicators.FarDistance"),
+		FarDistance,
+		TEXT("Indicators further than this from the view (cm) refresh their world position less often")
+	);
+
+	static int32 FarRefreshInterval = 4;
+	static FAutoConsoleVariableRef CVarFarRefreshInterval(
+		TEXT("Indicators.FarRefreshInterval"),
+		FarRefreshInterval,
+		TEXT("Far indicators refresh their world position (socket, bounds) once every this many canvas updates. They are still projected every update")
+	);
+}
+
 namespace EArrowDirection
 {
 	enum Type
@@ -181,6 +199,18 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 
 			bool IndicatorsChanged = false;
 
+			const FVector2f ScreenSize = PaintGeometry.Size;
+			const FVector ViewOrigin = ProjectionData.ViewOrigin;
+			const double FarDistanceSquared = FMath::Square(static_cast<double>(ActorCanvasCVars::FarDistance));
+			const uint32 FarRefreshInterval = static_cast<uint32>(FMath::Max(ActorCanvasCVars::FarRefreshInterval, 1));
+			++UpdateCounter;
+
+			BatchSlotIndices.Reset();
+			BatchWorldAnchors.Reset();
+
+			FIndicatorProjection Projector;
+
+			// Gather the world anchors of everything that can be shown, culling by distance before any projection
 			for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
 			{
 				FSlot& CurChild = CanvasChildren[ChildIndex];
@@ -214,14 +244,18 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 					IndicatorsChanged = true;
 				}
 
-				FVector ScreenPositionWithDepth;
-
-				FIndicatorProjection Projector;
-				const bool Success = Projector.Project(*Indicator, ProjectionData, PaintGeometry.Size,
-				                                       OUT ScreenPositionWithDepth);
-
-				if (!Success)
+				// Screen bounding boxes need every corner projected, they stay on the per-indicator path
+				const EActorCanvasProjectionMode ProjectionMode = Indicator->GetProjectionMode();
+				if (ProjectionMode == EActorCanvasProjectionMode::ComponentScreenBoundingBox ||
+					ProjectionMode == EActorCanvasProjectionMode::ActorScreenBoundingBox)
 				{
+					FVector ScreenPositionWithDepth;
+					if (Projector.Project(*Indicator, ProjectionData, ScreenSize, OUT ScreenPositionWithDepth))
+					{
+						IndicatorsChanged |= ApplyProjection(CurChild, ScreenPositionWithDepth, true, ScreenSize);
+						continue;
+					}
+
 					CurChild.SetHasValidScreenPosition(false);
 					CurChild.SetInFrontOfCamera(false);
 
@@ -230,20 +264,48 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 					continue;
 				}
 
-				CurChild.SetInFrontOfCamera(Success);
-				CurChild.SetHasValidScreenPosition(CurChild.GetInFrontOfCamera() || Indicator->GetClampToScreen());
+				// Far indicators refresh their anchor (socket transform, component bounds) every few updates, staggered
+				// over the slots. They are still projected every update so they follow the camera.
+				const bool bIsFar = CurChild.bHasWorldAnchor &&
+					FVector::DistSquared(ViewOrigin, CurChild.WorldAnchor) > FarDistanceSquared;
+				if (!bIsFar || ((UpdateCounter + ChildIndex) % FarRefreshInterval) == 0)
+				{
+					CurChild.bHasWorldAnchor = Projector.GetProjectionAnchor(*Indicator, CurChild.WorldAnchor);
+				}
 
-				if (CurChild.HasValidScreenPosition())
+				const double MaxVisibleDistance = Indicator->GetMaxVisibleDistance();
+				if (!CurChild.bHasWorldAnchor || (MaxVisibleDistance > 0.0 &&
+					FVector::DistSquared(ViewOrigin, CurChild.WorldAnchor) > FMath::Square(MaxVisibleDistance)))
 				{
-					// Only dirty the screen position if we can actually show this indicator.
-					CurChild.SetScreenPosition(FVector2D(ScreenPositionWithDepth));
-					CurChild.SetDepth(ScreenPositionWithDepth.X);
+					CurChild.SetHasValidScreenPosition(false);
+
+					IndicatorsChanged |= CurChild.bIsDirty();
+					CurChild.ClearDirtyFlag();
+					continue;
 				}
 
-				CurChild.SetPriority(Indicator->GetPriority());
+				BatchSlotIndices.Add(ChildIndex);
+				BatchWorldAnchors.Add(CurChild.WorldAnchor);
+			}
+
+			// Project every gathered anchor with the same view projection matrix
+			const FMatrix ViewProjectionMatrix = ProjectionData.ComputeViewProjectionMatrix();
+			BatchClipPositions.SetNumUninitialized(BatchWorldAnchors.Num(), EAllowShrinking::No);
+			for (int32 BatchIndex = 0; BatchIndex < BatchWorldAnchors.Num(); ++BatchIndex)
+			{
+				BatchClipPositions[BatchIndex] = ViewProjectionMatrix.TransformFVector4(FVector4(BatchWorldAnchors[BatchIndex], 1.0));
+			}
+
+			for (int32 BatchIndex = 0; BatchIndex < BatchSlotIndices.Num(); ++BatchIndex)
+			{
+				FSlot& CurChild = CanvasChildren[BatchSlotIndices[BatchIndex]];
+
+				FVector2D ScreenPosition;
+				const bool bInFrontOfCamera = FIndicatorProjection::ProjectClipPosition(
+					*CurChild.Indicator, BatchClipPositions[BatchIndex], ScreenSize, ScreenPosition);
 
-				IndicatorsChanged |= CurChild.bIsDirty();
-				CurChild.ClearDirtyFlag();
+				const FVector ScreenPositionWithDepth(ScreenPosition, FVector::Dist(ViewOrigin, BatchWorldAnchors[BatchIndex]));
+				IndicatorsChanged |= ApplyProjection(CurChild, ScreenPositionWithDepth, bInFrontOfCamera, ScreenSize);
 			}
 
 			if (IndicatorsChanged) { Invalidate(EInvalidateWidget::Paint); }
@@ -260,6 +322,70 @@ EActiveTimerReturnType SActorCanvas::UpdateCanvas(double InCurrentTime, float In
 	return EActiveTimerReturnType::Continue;
 }
 
+bool SActorCanvas::ApplyProjection(FSlot& Slot, const FVector& ScreenPositionWithDepth, const bool bInFrontOfCamera,
+                                   const FVector2f& ScreenSize) const
+{
+	const UIndicatorDescriptor* Indicator = Slot.Indicator;
+	const FVector2D ScreenPosition(ScreenPositionWithDepth);
+
+	// Clamped indicators always show up on an edge. Others are culled once no part of the widget can overlap the screen.
+	bool bCanBeOnScreen = Indicator->GetClampToScreen();
+	if (!bCanBeOnScreen && bInFrontOfCamera)
+	{
+		FVector2D Extent = FVector2D::ZeroVector;
+		if (const TSharedPtr<SWidget> CanvasHost = Indicator->CanvasHost.Pin()) { Extent = CanvasHost->GetDesiredSize(); }
+
+		bCanBeOnScreen = ScreenPosition.X >= -Extent.X && ScreenPosition.Y >= -Extent.Y &&
+			ScreenPosition.X <= ScreenSize.X + Extent.X && ScreenPosition.Y <= ScreenSize.Y + Extent.Y;
+	}
+
+	Slot.SetInFrontOfCamera(bInFrontOfCamera);
+	Slot.SetHasValidScreenPosition(bCanBeOnScreen);
+
+	if (bCanBeOnScreen)
+	{
+		// Only dirty the screen position if we can actually show this indicator.
+		Slot.SetScreenPosition(ScreenPosition);
+		Slot.SetDepth(ScreenPositionWithDepth.Z);
+	}
+
+	Slot.SetPriority(Indicator->GetPriority());
+
+	const bool bChanged = Slot.bIsDirty();
+	Slot.ClearDirtyFlag();
+	return bChanged;
+}
+
+void SActorCanvas::UpdateSortedSlots() const
+{
+	if (bSortedSlotsDirty || SortedSlotIndices.Num() != CanvasChildren.Num())
+	{
+		SortedSlotIndices.SetNumUninitialized(CanvasChildren.Num());
+		for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex) { SortedSlotIndices[ChildIndex] = ChildIndex; }
+		bSortedSlotsDirty = false;
+	}
+
+	auto ArrangesBefore = [this](const int32 A, const int32 B)
+	{
+		const FSlot& SlotA = CanvasChildren[A];
+		const FSlot& SlotB = CanvasChildren[B];
+		return SlotA.GetPriority() == SlotB.GetPriority() ? SlotA.GetDepth() > SlotB.GetDepth() : SlotA.GetPriority() < SlotB.GetPriority();
+	};
+
+	// Insertion sort: stable, and a single pass when the order didn't change since the last arrange
+	for (int32 SortedIndex = 1; SortedIndex < SortedSlotIndices.Num(); ++SortedIndex)
+	{
+		const int32 SlotIndex = SortedSlotIndices[SortedIndex];
+		int32 InsertIndex = SortedIndex;
+		while (InsertIndex > 0 && ArrangesBefore(SlotIndex, SortedSlotIndices[InsertIndex - 1]))
+		{
+			SortedSlotIndices[InsertIndex] = SortedSlotIndices[InsertIndex - 1];
+			--InsertIndex;
+		}
+		SortedSlotIndices[InsertIndex] = SlotIndex;
+	}
+}
+
 void SActorCanvas::SetShowAnyIndicators(const bool bIndicators)
 {
 	if (bShowAnyIndicators == bIndicators) { return; }
@@ -286,21 +412,13 @@ void SActorCanvas::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrange
 		const FVector Center = FVector(AllottedGeometry.Size * 0.5f, 0.0f);
 
 		// Sort the children
-		TArray<const FSlot*> SortedSlots;
-		for (int32 ChildIndex = 0; ChildIndex < CanvasChildren.Num(); ++ChildIndex)
-		{
-			SortedSlots.Add(&CanvasChildren[ChildIndex]);
-		}
-
-		SortedSlots.StableSort([](const FSlot& A, const FSlot& B){
-			return A.GetPriority() == B.GetPriority() ? A.GetDepth() > B.GetDepth() : A.GetPriority() < B.GetPriority();
-		});
+		UpdateSortedSlots();
 
 		// Go through all the sorted children
-		for (int32 ChildIndex = 0; ChildIndex < SortedSlots.Num(); ++ChildIndex)
+		for (const int32 SlotIndex : SortedSlotIndices)
 		{
 			//grab a child
-			const FSlot& CurChild = *SortedSlots[ChildIndex];
+			const FSlot& CurChild = CanvasChildren[SlotIndex];
 			const UIndicatorDescriptor* Indicator = CurChild.Indicator;
 
 			// Skip this indicator if it's invalid or has an invalid world position
@@ -590,7 +708,11 @@ SActorCanvas::FScopedWidgetSlotArguments SActorCanvas::AddActorSlot(UIndicatorDe
 	return FScopedWidgetSlotArguments{
 		MakeUnique<FSlot>(Indicator), this->CanvasChildren, INDEX_NONE,
 		[WeakCanvas](const FSlot*, int32){
-			if (const TSharedPtr<SActorCanvas> Canvas = WeakCanvas.Pin()) { Canvas->UpdateActiveTimer(); }
+			if (const TSharedPtr<SActorCanvas> Canvas = WeakCanvas.Pin())
+			{
+				Canvas->bSortedSlotsDirty = true;
+				Canvas->UpdateActiveTimer();
+			}
 		}
 	};
 }
@@ -602,6 +724,7 @@ int32 SActorCanvas::RemoveActorSlot(const TSharedRef<SWidget>& SlotWidget)
 		if (!CanvasChildren.IsValidIndex(SlotIdx) || SlotWidget != CanvasChildren[SlotIdx].GetWidget()) { continue; }
 
 		CanvasChildren.RemoveAt(SlotIdx);
+		bSortedSlotsDirty = true;
 		UpdateActiveTimer();
 		return SlotIdx;
 	}
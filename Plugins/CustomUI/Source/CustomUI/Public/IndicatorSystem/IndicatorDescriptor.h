@@ -32,6 +32,20 @@ struct FIndicatorProjection
 	                              const FSceneViewProjectionData& InProjectionData, const FVector2f& ScreenSize,
 	                              const FVector& ProjectWorldLocation, EActorCanvasProjectionMode ProjectionMode,
 	                              FVector& OutScreenPositionWithDepth) const;
+
+
+	/**
+	 * World point the indicator is placed at, for the batched path of SActorCanvas.
+	 * Returns false for the screen bounding box modes, which need the whole box projected (use Project for those).
+	 */
+	bool GetProjectionAnchor(const UIndicatorDescriptor& IndicatorDescriptor, FVector& OutWorldAnchor) const;
+
+	/**
+	 * Turns an already transformed anchor (ViewProjectionMatrix * WorldAnchor) into a screen position, the same way
+	 * Project does for a point. Returns whether the anchor is in front of the camera.
+	 */
+	static bool ProjectClipPosition(const UIndicatorDescriptor& IndicatorDescriptor, const FVector4& ClipPosition,
+	                                const FVector2f& ScreenSize, FVector2D& OutScreenPosition);
 };
 
 UENUM(BlueprintType)
@@ -109,6 +123,13 @@ public:
 	UFUNCTION(BlueprintCallable)
 	void SetDesiredVisibility(const bool InVisible) { bVisible = InVisible; }
 
+	// Beyond this distance from the view the indicator is hidden without being projected (0: no limit).
+	UFUNCTION(BlueprintCallable)
+	float GetMaxVisibleDistance() const { return MaxVisibleDistance; }
+
+	UFUNCTION(BlueprintCallable)
+	void SetMaxVisibleDistance(const float InMaxVisibleDistance) { MaxVisibleDistance = InMaxVisibleDistance; }
+
 	UFUNCTION(BlueprintCallable)
 	EActorCanvasProjectionMode GetProjectionMode() const { return ProjectionMode; }
 
@@ -204,6 +225,9 @@ private:
 	UPROPERTY()
 	int32 Priority = 0;
 
+	UPROPERTY()
+	float MaxVisibleDistance = 0.0f;
+
 	UPROPERTY()
 	FVector BoundingBoxAnchor = FVector(0.5);
 
@@ -29,12 +29,14 @@ public:
 			: TSlotBase<FSlot>()
 			  , Indicator(InIndicator)
 			  , ScreenPosition(FVector2D::ZeroVector)
+			  , WorldAnchor(FVector::ZeroVector)
 			  , Depth(0)
 			  , Priority(0.f)
 			  , bIsIndicatorVisible(true)
 			  , bInFrontOfCamera(true)
 			  , bHasValidScreenPosition(false)
 			  , bDirty(true)
+			  , bHasWorldAnchor(false)
 			  , bWasIndicatorClamped(false)
 			  , bWasIndicatorClampedStatusChanged(false) {}
 
@@ -143,6 +145,8 @@ public:
 		//Kept Alive by SActorCanvas::AddReferencedObjects
 		UIndicatorDescriptor* Indicator;
 		FVector2D ScreenPosition;
+		/** World point projected by the batched pass, refreshed less often for far indicators */
+		FVector WorldAnchor;
 		double Depth;
 		int32 Priority;
 
@@ -150,6 +154,7 @@ public:
 		uint8 bInFrontOfCamera : 1;
 		uint8 bHasValidScreenPosition : 1;
 		uint8 bDirty : 1;
+		uint8 bHasWorldAnchor : 1;
 
 		/** 
 		 * Cached & frame-deferred value of whether the indicator was visually screen clamped last frame or not; 
@@ -223,6 +228,24 @@ private:
 
 	void UpdateActiveTimer();
 
+	/** Applies a projected position to a slot, culling it when it can't end up on screen. Returns whether it changed */
+	bool ApplyProjection(FSlot& Slot, const FVector& ScreenPositionWithDepth, bool bInFrontOfCamera,
+	                     const FVector2f& ScreenSize) const;
+
+	/** Brings SortedSlotIndices up to date, nearly sorted from the last arrange so this is usually a single pass */
+	void UpdateSortedSlots() const;
+
+	/** Scratch arrays of the batched projection, reused every update */
+	TArray<int32> BatchSlotIndices;
+	TArray<FVector> BatchWorldAnchors;
+	TArray<FVector4> BatchClipPositions;
+
+	/** Children indices in arrange order: priority, then back to front */
+	mutable TArray<int32> SortedSlotIndices;
+	mutable bool bSortedSlotsDirty = true;
+
+	uint32 UpdateCounter = 0;
+
 	TArray<TObjectPtr<UIndicatorDescriptor>> AllIndicators;
 	TArray<UIndicatorDescriptor*> InactiveIndicators;
 
@@ -9,19 +9,262 @@
 #include "GameFramework/GameState.h"
 #include "GameFramework/PlayerState.h"
 // #include "GameModes/LyraGameState.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
 #include "Interfaces/IGameStateFpsInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 #include "Performance/LyraPerformanceStatTypes.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(LyraPerformanceStatSubsystem)
 
+DEFINE_LOG_CATEGORY_STATIC(LogLyraPerformanceStats, Log, All);
+
 class FSubsystemCollectionBase;
 
+namespace LyraPerformanceStatCVars
+{
+	static int32 HistorySize = 4096;
+	static FAutoConsoleVariableRef CVarHistorySize(
+		TEXT("Lyra.PerfStats.HistorySize"),
+		HistorySize,
+		TEXT("Number of frames kept in the performance stat history. Applied when the stats (re)start")
+	);
+
+	static float HitchThresholdMS = 60.0f;
+	static FAutoConsoleVariableRef CVarHitchThresholdMS(
+		TEXT("Lyra.PerfStats.HitchThresholdMS"),
+		HitchThresholdMS,
+		TEXT("Frames longer than this (ms) count as hitches. 0 disables the absolute threshold")
+	);
+
+	static float HitchMedianMultiplier = 2.5f;
+	static FAutoConsoleVariableRef CVarHitchMedianMultiplier(
+		TEXT("Lyra.PerfStats.HitchMedianMultiplier"),
+		HitchMedianMultiplier,
+		TEXT("Frames longer than this many times the rolling median frame time count as hitches. 0 disables the relative threshold")
+	);
+
+	static int32 HitchMinSamples = 60;
+	static FAutoConsoleVariableRef CVarHitchMinSamples(
+		TEXT("Lyra.PerfStats.HitchMinSamples"),
+		HitchMinSamples,
+		TEXT("Number of frames in the history before the relative hitch threshold applies")
+	);
+}
+
+//////////////////////////////////////////////////////////////////////
+// FLyraPerformanceStatHistory
+
+namespace LyraPerformanceStatHistogram
+{
+	// Log-scale buckets: 16 per power of two between 2^-20 and 2^20, which covers seconds, ms, Hz and bytes alike.
+	// Bucket 0 holds zero and anything below the range.
+	static constexpr int32 BucketsPerOctave = 16;
+	static constexpr int32 MinExponent = -20;
+	static constexpr int32 MaxExponent = 20;
+	static constexpr int32 NumBuckets = 1 + (MaxExponent - MinExponent) * BucketsPerOctave;
+}
+
+void FLyraPerformanceStatHistory::Reset(const int32 InCapacity)
+{
+	Samples.SetNumZeroed(FMath::Max(InCapacity, 0));
+	Buckets.Init(0, LyraPerformanceStatHistogram::NumBuckets);
+	Head = 0;
+	Count = 0;
+	Sum = 0.0;
+	Min = 0.0;
+	Max = 0.0;
+}
+
+void FLyraPerformanceStatHistory::AddSample(const double Value)
+{
+	const int32 Capacity = Samples.Num();
+	if (Capacity == 0) { return; }
+
+	bool bEvictedExtreme = false;
+	if (Count == Capacity)
+	{
+		const double Evicted = Samples[Head];
+		Sum -= Evicted;
+		--Buckets[GetBucketIndex(Evicted)];
+		bEvictedExtreme = (Evicted <= Min) || (Evicted >= Max);
+	}
+	else
+	{
+		++Count;
+	}
+
+	const float Stored = static_cast<float>(Value);
+	Samples[Head] = Stored;
+	Head = (Head + 1) % Capacity;
+	Sum += Stored;
+	++Buckets[GetBucketIndex(Stored)];
+
+	if (bEvictedExtreme)
+	{
+		// The evicted sample may have been the only one at the extreme, rescan (rare, the extremes tend to stay in the window)
+		RescanMinMax();
+	}
+	else if (Count == 1)
+	{
+		Min = Max = Stored;
+	}
+	else
+	{
+		Min = FMath::Min<double>(Min, Stored);
+		Max = FMath::Max<double>(Max, Stored);
+	}
+
+	// Resum once per lap so the running sum doesn't drift
+	if (Head == 0)
+	{
+		Sum = 0.0;
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			Sum += Samples[Index];
+		}
+	}
+}
+
+double FLyraPerformanceStatHistory::GetSample(const int32 Index) const
+{
+	check(Index >= 0 && Index < Count);
+	const int32 Oldest = (Count == Samples.Num()) ? Head : 0;
+	return Samples[(Oldest + Index) % Samples.Num()];
+}
+
+FLyraPerformanceStatSummary FLyraPerformanceStatHistory::GetSummary() const
+{
+	FLyraPerformanceStatSummary Summary;
+	Summary.NumSamples = Count;
+	if (Count == 0) { return Summary; }
+
+	Summary.Min = Min;
+	Summary.Max = Max;
+	Summary.Average = Sum / Count;
+	Summary.P50 = GetPercentile(0.50);
+	Summary.P95 = GetPercentile(0.95);
+	Summary.P99 = GetPercentile(0.99);
+	return Summary;
+}
+
+double FLyraPerformanceStatHistory::GetPercentile(const double Fraction) const
+{
+	if (Count == 0) { return 0.0; }
+
+	const int32 Rank = FMath::Clamp(FMath::CeilToInt32(Fraction * Count), 1, Count);
+	int32 Cumulative = 0;
+	for (int32 BucketIndex = 0; BucketIndex < Buckets.Num(); ++BucketIndex)
+	{
+		Cumulative += Buckets[BucketIndex];
+		if (Cumulative >= Rank)
+		{
+			return FMath::Clamp(GetBucketValue(BucketIndex), Min, Max);
+		}
+	}
+
+	return Max;
+}
+
+int32 FLyraPerformanceStatHistory::GetBucketIndex(const double Value)
+{
+	using namespace LyraPerformanceStatHistogram;
+
+	if (Value <= FMath::Exp2(static_cast<double>(MinExponent))) { return 0; }
+
+	const int32 Index = 1 + FMath::FloorToInt32((FMath::Log2(Value) - MinExponent) * BucketsPerOctave);
+	return FMath::Clamp(Index, 1, NumBuckets - 1);
+}
+
+double FLyraPerformanceStatHistory::GetBucketValue(const int32 BucketIndex)
+{
+	using namespace LyraPerformanceStatHistogram;
+
+	if (BucketIndex == 0) { return 0.0; }
+
+	// Geometric middle of the bucket
+	return FMath::Exp2(MinExponent + (BucketIndex - 0.5) / BucketsPerOctave);
+}
+
+void FLyraPerformanceStatHistory::RescanMinMax()
+{
+	Min = TNumericLimits<double>::Max();
+	Max = TNumericLimits<double>::Lowest();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		Min = FMath::Min<double>(Min, Samples[Index]);
+		Max = FMath::Max<double>(Max, Samples[Index]);
+	}
+}
+
 //////////////////////////////////////////////////////////////////////
 // FLyraPerformanceStatCache
 
-void FLyraPerformanceStatCache::StartCharting() {}
+void FLyraPerformanceStatCache::StartCharting()
+{
+	const int32 Capacity = FMath::Max(LyraPerformanceStatCVars::HistorySize, 1);
+	for (FLyraPerformanceStatHistory& StatHistory : History)
+	{
+		StatHistory.Reset(Capacity);
+	}
+
+	FrameTimestamps.SetNumZeroed(Capacity);
+	FrameHitches.SetNumZeroed(Capacity);
+	FrameHead = 0;
+	NumHitches = 0;
+}
 
 void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
+{
+	UpdateCachedStats(FrameData);
+	RecordFrame();
+}
+
+void FLyraPerformanceStatCache::RecordFrame()
+{
+	if (FrameTimestamps.Num() == 0) { return; }
+
+	// Hitch check against the history before this frame goes in
+	const double FrameTime = GetCachedStat(ELyraDisplayablePerformanceStat::FrameTime);
+	const FLyraPerformanceStatHistory& FrameTimeHistory = GetHistory(ELyraDisplayablePerformanceStat::FrameTime);
+
+	bool bHitch = (LyraPerformanceStatCVars::HitchThresholdMS > 0.0f) && (FrameTime * 1000.0 > LyraPerformanceStatCVars::HitchThresholdMS);
+	if (!bHitch && (LyraPerformanceStatCVars::HitchMedianMultiplier > 0.0f) && (FrameTimeHistory.Num() >= LyraPerformanceStatCVars::HitchMinSamples))
+	{
+		bHitch = FrameTime > FrameTimeHistory.GetPercentile(0.5) * LyraPerformanceStatCVars::HitchMedianMultiplier;
+	}
+
+	for (const ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+	{
+		History[static_cast<int32>(Stat)].AddSample(GetCachedStat(Stat));
+	}
+
+	FrameTimestamps[FrameHead] = FPlatformTime::Seconds();
+	FrameHitches[FrameHead] = bHitch;
+	FrameHead = (FrameHead + 1) % FrameTimestamps.Num();
+
+	if (bHitch)
+	{
+		++NumHitches;
+
+		// Blame the slowest of the threads that make up the frame
+		ELyraDisplayablePerformanceStat Bottleneck = ELyraDisplayablePerformanceStat::FrameTime_GameThread;
+		for (const ELyraDisplayablePerformanceStat Stat : {ELyraDisplayablePerformanceStat::FrameTime_RenderThread, ELyraDisplayablePerformanceStat::FrameTime_RHIThread, ELyraDisplayablePerformanceStat::FrameTime_GPU})
+		{
+			if (GetCachedStat(Stat) > GetCachedStat(Bottleneck)) { Bottleneck = Stat; }
+		}
+
+		UE_LOG(LogLyraPerformanceStats, Verbose, TEXT("Hitch: %.1f ms frame (median %.1f ms), %s %.1f ms"),
+		       FrameTime * 1000.0, FrameTimeHistory.GetPercentile(0.5) * 1000.0,
+		       *StaticEnum<ELyraDisplayablePerformanceStat>()->GetNameStringByValue(static_cast<int64>(Bottleneck)),
+		       GetCachedStat(Bottleneck) * 1000.0);
+
+		OnHitch.Broadcast(FrameTime, Bottleneck);
+	}
+}
+
+void FLyraPerformanceStatCache::UpdateCachedStats(const FFrameData& FrameData)
 {
 	CachedData = FrameData;
 	CachedServerFPS = 0.0f;
@@ -80,7 +323,113 @@ void FLyraPerformanceStatCache::ProcessFrame(const FFrameData& FrameData)
 		                           : 0.0f;
 }
 
-void FLyraPerformanceStatCache::StopCharting() {}
+void FLyraPerformanceStatCache::StopCharting()
+{
+	for (FLyraPerformanceStatHistory& StatHistory : History)
+	{
+		StatHistory.Reset(0);
+	}
+
+	FrameTimestamps.Empty();
+	FrameHitches.Empty();
+	FrameHead = 0;
+}
+
+FString FLyraPerformanceStatCache::DumpHistory(const float Seconds, const bool bAsJson) const
+{
+	const int32 Capacity = FrameTimestamps.Num();
+	const int32 NumFrames = GetHistory(ELyraDisplayablePerformanceStat::FrameTime).Num();
+	if (NumFrames == 0) { return FString(); }
+
+	// Frames are in the same slots for the timestamps and every stat history, walk back from the newest
+	const int32 OldestSlot = (NumFrames == Capacity) ? FrameHead : 0;
+	const double NewestTime = FrameTimestamps[(OldestSlot + NumFrames - 1) % Capacity];
+	int32 FirstFrame = NumFrames - 1;
+	while (FirstFrame > 0 && NewestTime - FrameTimestamps[(OldestSlot + FirstFrame - 1) % Capacity] <= Seconds)
+	{
+		--FirstFrame;
+	}
+
+	const UEnum* StatEnum = StaticEnum<ELyraDisplayablePerformanceStat>();
+	TStringBuilder<256> Line;
+	FString Output;
+
+	if (!bAsJson)
+	{
+		Output += TEXT("Time,Hitch");
+		for (const ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+		{
+			Output += TEXT(",") + StatEnum->GetNameStringByValue(static_cast<int64>(Stat));
+		}
+		Output += LINE_TERMINATOR;
+
+		for (int32 Frame = FirstFrame; Frame < NumFrames; ++Frame)
+		{
+			const int32 Slot = (OldestSlot + Frame) % Capacity;
+			Line.Reset();
+			Line.Appendf(TEXT("%.4f,%d"), FrameTimestamps[Slot] - NewestTime, FrameHitches[Slot] ? 1 : 0);
+			for (const ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+			{
+				Line.Appendf(TEXT(",%g"), GetHistory(Stat).GetSample(Frame));
+			}
+			Output += Line.ToString();
+			Output += LINE_TERMINATOR;
+		}
+	}
+	else
+	{
+		int32 NumDumpedHitches = 0;
+		for (int32 Frame = FirstFrame; Frame < NumFrames; ++Frame)
+		{
+			NumDumpedHitches += FrameHitches[(OldestSlot + Frame) % Capacity] ? 1 : 0;
+		}
+
+		Output += FString::Printf(TEXT("{\n\t\"seconds\": %g,\n\t\"frames\": %d,\n\t\"hitches\": %d,\n\t\"stats\": {"),
+		                          NewestTime - FrameTimestamps[(OldestSlot + FirstFrame) % Capacity], NumFrames - FirstFrame, NumDumpedHitches);
+
+		bool bFirstStat = true;
+		for (const ELyraDisplayablePerformanceStat Stat : TEnumRange<ELyraDisplayablePerformanceStat>())
+		{
+			// Exact statistics over the dumped range (the rolling summary covers the whole window)
+			TArray<double> Values;
+			Values.Reserve(NumFrames - FirstFrame);
+			for (int32 Frame = FirstFrame; Frame < NumFrames; ++Frame)
+			{
+				Values.Add(GetHistory(Stat).GetSample(Frame));
+			}
+
+			TArray<double> Sorted = Values;
+			Sorted.Sort();
+			double Sum = 0.0;
+			for (const double Value : Values) { Sum += Value; }
+			auto Percentile = [&Sorted](const double Fraction) { return Sorted[FMath::Clamp(FMath::CeilToInt32(Fraction * Sorted.Num()) - 1, 0, Sorted.Num() - 1)]; };
+
+			Output += FString::Printf(TEXT("%s\n\t\t\"%s\": {\"min\": %g, \"avg\": %g, \"max\": %g, \"p50\": %g, \"p95\": %g, \"p99\": %g, \"samples\": ["),
+			                          bFirstStat ? TEXT("") : TEXT(","), *StatEnum->GetNameStringByValue(static_cast<int64>(Stat)),
+			                          Sorted[0], Sum / Sorted.Num(), Sorted.Last(), Percentile(0.50), Percentile(0.95), Percentile(0.99));
+			for (int32 Index = 0; Index < Values.Num(); ++Index)
+			{
+				Output += FString::Printf(Index == 0 ? TEXT("%g") : TEXT(", %g"), Values[Index]);
+			}
+			Output += TEXT("]}");
+			bFirstStat = false;
+		}
+
+		Output += TEXT("\n\t}\n}\n");
+	}
+
+	const FString OutputDir = FPaths::ProjectSavedDir() / TEXT("PerfStats");
+	IFileManager::Get().MakeDirectory(*OutputDir, true);
+
+	const FString Filename = OutputDir / FString::Printf(TEXT("PerfStats-%s.%s"), *FDateTime::Now().ToString(), bAsJson ? TEXT("json") : TEXT("csv"));
+	if (!FFileHelper::SaveStringToFile(Output, *Filename))
+	{
+		UE_LOG(LogLyraPerformanceStats, Warning, TEXT("Failed to write performance stats to %s"), *Filename);
+		return FString();
+	}
+
+	return IFileManager::Get().ConvertToAbsolutePathForExternalAppForRead(*Filename);
+}
 
 double FLyraPerformanceStatCache::GetCachedStat(ELyraDisplayablePerformanceStat Stat) const
 {
@@ -147,3 +496,58 @@ double ULyraPerformanceStatSubsystem::GetCachedStat(ELyraDisplayablePerformanceS
 {
 	return Tracker->GetCachedStat(Stat);
 }
+
+FLyraPerformanceStatSummary ULyraPerformanceStatSubsystem::GetStatSummary(ELyraDisplayablePerformanceStat Stat) const
+{
+	if (Stat >= ELyraDisplayablePerformanceStat::Count) { return FLyraPerformanceStatSummary(); }
+
+	return Tracker->GetHistory(Stat).GetSummary();
+}
+
+void ULyraPerformanceStatSubsystem::GetStatHistory(ELyraDisplayablePerformanceStat Stat, TArray<double>& OutSamples, int32 MaxSamples) const
+{
+	OutSamples.Reset();
+	if (Stat >= ELyraDisplayablePerformanceStat::Count) { return; }
+
+	const FLyraPerformanceStatHistory& StatHistory = Tracker->GetHistory(Stat);
+	const int32 NumSamples = FMath::Min(FMath::Max(MaxSamples, 0), StatHistory.Num());
+	OutSamples.Reserve(NumSamples);
+	for (int32 Index = StatHistory.Num() - NumSamples; Index < StatHistory.Num(); ++Index)
+	{
+		OutSamples.Add(StatHistory.GetSample(Index));
+	}
+}
+
+int32 ULyraPerformanceStatSubsystem::GetNumHitches() const
+{
+	return Tracker->GetNumHitches();
+}
+
+FString ULyraPerformanceStatSubsystem::DumpStatHistory(float Seconds, bool bAsJson) const
+{
+	return Tracker->DumpHistory(Seconds, bAsJson);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GLyraDumpPerfStatsCmd(
+	TEXT("Lyra.PerfStats.Dump"),
+	TEXT("Writes the last N seconds (default 30) of every performance stat to Saved/PerfStats. Usage: Lyra.PerfStats.Dump [Seconds] [json]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(
+		[](const TArray<FString>& Params, UWorld* World)
+		{
+			const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+			const ULyraPerformanceStatSubsystem* Subsystem = GameInstance ? GameInstance->GetSubsystem<ULyraPerformanceStatSubsystem>() : nullptr;
+			if (!Subsystem)
+			{
+				UE_LOG(LogLyraPerformanceStats, Warning, TEXT("Lyra.PerfStats.Dump: no performance stat subsystem"));
+				return;
+			}
+
+			const float Seconds = Params.IsValidIndex(0) ? FCString::Atof(*Params[0]) : 30.0f;
+			const bool bAsJson = Params.IsValidIndex(1) && Params[1].Equals(TEXT("json"), ESearchCase::IgnoreCase);
+
+			const FString Filename = Subsystem->DumpStatHistory(Seconds > 0.0f ? Seconds : 30.0f, bAsJson);
+			if (!Filename.IsEmpty())
+			{
+				UE_LOG(LogLyraPerformanceStats, Display, TEXT("Wrote performance stats (%d hitches so far) to %s"), Subsystem->GetNumHitches(), *Filename);
+			}
+		}));
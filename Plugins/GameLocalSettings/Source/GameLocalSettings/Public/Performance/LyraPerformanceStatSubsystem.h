@@ -3,12 +3,11 @@
 #pragma once
 
 #include "ChartCreation.h"
+#include "Performance/LyraPerformanceStatTypes.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 
 #include "LyraPerformanceStatSubsystem.generated.h"
 
-enum class ELyraDisplayablePerformanceStat : uint8;
-
 class FSubsystemCollectionBase;
 class ULyraPerformanceStatSubsystem;
 class UObject;
@@ -16,7 +15,40 @@ struct FFrame;
 
 //////////////////////////////////////////////////////////////////////
 
-// Observer which caches the stats for the previous frame
+// Called when a frame goes over the hitch thresholds, with its frame time and the stat (thread) that took the longest
+DECLARE_MULTICAST_DELEGATE_TwoParams(FLyraPerformanceHitchDelegate, double /*FrameTimeSeconds*/, ELyraDisplayablePerformanceStat /*Bottleneck*/);
+
+// Fixed-size history of one stat. Min/avg/max and a log-scale histogram (for the percentiles) are updated
+// as samples come in and fall out, so a summary never has to go over the whole window.
+// Written and read on the game thread only (where performance consumers are ticked), so it needs no locking.
+struct FLyraPerformanceStatHistory
+{
+	void Reset(int32 InCapacity);
+	void AddSample(double Value);
+
+	int32 Num() const { return Count; }
+
+	// Index 0 is the oldest sample still in the window
+	double GetSample(int32 Index) const;
+
+	FLyraPerformanceStatSummary GetSummary() const;
+	double GetPercentile(double Fraction) const;
+
+private:
+	static int32 GetBucketIndex(double Value);
+	static double GetBucketValue(int32 BucketIndex);
+	void RescanMinMax();
+
+	TArray<float> Samples;
+	TArray<int32> Buckets;
+	int32 Head = 0;
+	int32 Count = 0;
+	double Sum = 0.0;
+	double Min = 0.0;
+	double Max = 0.0;
+};
+
+// Observer which caches the stats for the previous frame and keeps a history of them
 struct FLyraPerformanceStatCache : IPerformanceDataConsumer
 {
 	FLyraPerformanceStatCache(ULyraPerformanceStatSubsystem* InSubsystem)
@@ -30,10 +62,30 @@ struct FLyraPerformanceStatCache : IPerformanceDataConsumer
 
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	const FLyraPerformanceStatHistory& GetHistory(ELyraDisplayablePerformanceStat Stat) const { return History[static_cast<int32>(Stat)]; }
+
+	int32 GetNumHitches() const { return NumHitches; }
+
+	// Writes the last Seconds of history to the saved dir as CSV or JSON, returns the file path (empty on failure)
+	FString DumpHistory(float Seconds, bool bAsJson) const;
+
+	FLyraPerformanceHitchDelegate OnHitch;
+
 protected:
+	void UpdateCachedStats(const FFrameData& FrameData);
+	void RecordFrame();
+
 	FFrameData CachedData;
 	ULyraPerformanceStatSubsystem* MySubsystem;
 
+	FLyraPerformanceStatHistory History[static_cast<int32>(ELyraDisplayablePerformanceStat::Count)];
+
+	// Per frame data shared by all stats, in the same slots as the stat histories
+	TArray<double> FrameTimestamps;
+	TArray<bool> FrameHitches;
+	int32 FrameHead = 0;
+	int32 NumHitches = 0;
+
 	float CachedServerFPS = 0.0f;
 	float CachedPingMS = 0.0f;
 	float CachedPacketLossIncomingPercent = 0.0f;
@@ -56,6 +108,24 @@ public:
 	UFUNCTION(BlueprintCallable)
 	double GetCachedStat(ELyraDisplayablePerformanceStat Stat) const;
 
+	// Rolling min/avg/max/percentiles of a stat over the history window
+	UFUNCTION(BlueprintCallable)
+	FLyraPerformanceStatSummary GetStatSummary(ELyraDisplayablePerformanceStat Stat) const;
+
+	// The last MaxSamples values of a stat, oldest first, e.g. to draw a graph
+	UFUNCTION(BlueprintCallable)
+	void GetStatHistory(ELyraDisplayablePerformanceStat Stat, TArray<double>& OutSamples, int32 MaxSamples = 240) const;
+
+	// Number of hitches detected since the stats started
+	UFUNCTION(BlueprintCallable)
+	int32 GetNumHitches() const;
+
+	// Writes the last Seconds of every stat to Saved/PerfStats, returns the file path (empty on failure)
+	UFUNCTION(BlueprintCallable)
+	FString DumpStatHistory(float Seconds = 30.0f, bool bAsJson = false) const;
+
+	FLyraPerformanceHitchDelegate& OnHitch() { return Tracker->OnHitch; }
+
 	//~USubsystem interface
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
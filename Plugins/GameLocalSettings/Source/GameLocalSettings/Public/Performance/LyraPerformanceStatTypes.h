@@ -84,3 +84,35 @@ enum class ELyraDisplayablePerformanceStat : uint8
 ENUM_RANGE_BY_COUNT(ELyraDisplayablePerformanceStat, ELyraDisplayablePerformanceStat::Count);
 
 //////////////////////////////////////////////////////////////////////
+
+// Rolling statistics of one stat over its history window
+USTRUCT(BlueprintType)
+struct FLyraPerformanceStatSummary
+{
+	GENERATED_BODY()
+
+	// Number of frames the statistics cover
+	UPROPERTY(BlueprintReadOnly, Category=Performance)
+	int32 NumSamples = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category=Performance)
+	double Min = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category=Performance)
+	double Average = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category=Performance)
+	double Max = 0.0;
+
+	// Percentiles are approximated to ~4% (the resolution of the history histogram)
+	UPROPERTY(BlueprintReadOnly, Category=Performance)
+	double P50 = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category=Performance)
+	double P95 = 0.0;
+
+	UPROPERTY(BlueprintReadOnly, Category=Performance)
+	double P99 = 0.0;
+};
+
+//////////////////////////////////////////////////////////////////////
@@ -4,6 +4,7 @@
 #include "Engine/Engine.h"
 #include "Engine/GameInstance.h"
 #include "Engine/World.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 #include "UObject/ScriptMacros.h"
 #include "UObject/Stack.h"
 
@@ -11,6 +12,15 @@
 
 DEFINE_LOG_CATEGORY(LogGameplayMessageSubsystem);
 
+DECLARE_STATS_GROUP(TEXT("GameplayMessages"), STATGROUP_GameplayMessages, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Broadcast"), STAT_GameplayMessages_Broadcast, STATGROUP_GameplayMessages);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Broadcasts"), STAT_GameplayMessages_Broadcasts, STATGROUP_GameplayMessages);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Listener Invocations"), STAT_GameplayMessages_ListenerInvocations,
+                           STATGROUP_GameplayMessages);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Type Mismatches"), STAT_GameplayMessages_TypeMismatches, STATGROUP_GameplayMessages);
+
+CSV_DEFINE_CATEGORY(GameplayMessages, false);
+
 namespace UE::GameplayMessageSubsystem
 {
 	static int32 ShouldLogMessages = 0;
@@ -18,6 +28,42 @@ namespace UE::GameplayMessageSubsystem
 	                                                     ShouldLogMessages,
 	                                                     TEXT(
 		                                                     "Should messages broadcast through the gameplay message subsystem be logged?"));
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+	static bool bCollectStats = true;
+	static FAutoConsoleVariableRef CVarCollectStats(TEXT("GameplayMessageSubsystem.CollectStats"),
+	                                                bCollectStats,
+	                                                TEXT(
+		                                                "Should per-channel and per-listener broadcast counters be collected?"));
+
+	static void ForEachSubsystem(UWorld* World, TFunctionRef<void(UGameplayMessageSubsystem&)> Func)
+	{
+		if (const UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr)
+		{
+			if (UGameplayMessageSubsystem* Router = GameInstance->GetSubsystem<UGameplayMessageSubsystem>())
+			{
+				Func(*Router);
+			}
+		}
+	}
+
+	static FAutoConsoleCommandWithWorldArgsAndOutputDevice CmdDumpStats(
+		TEXT("GameplayMessageSubsystem.DumpStats"),
+		TEXT("Lists broadcast counters and callback times per gameplay message channel and listener."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda(
+			[](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+			{
+				ForEachSubsystem(World, [&Ar](UGameplayMessageSubsystem& Router) { Router.DumpStats(Ar); });
+			}));
+
+	static FAutoConsoleCommandWithWorldAndArgs CmdResetStats(
+		TEXT("GameplayMessageSubsystem.ResetStats"),
+		TEXT("Clears the counters reported by GameplayMessageSubsystem.DumpStats."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			ForEachSubsystem(World, [](UGameplayMessageSubsystem& Router) { Router.ResetStats(); });
+		}));
+#endif
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -34,6 +80,24 @@ void FGameplayMessageListenerHandle::Unregister()
 	}
 }
 
+//////////////////////////////////////////////////////////////////////
+// FGameplayMessageQueueTickFunction
+
+void FGameplayMessageQueueTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType,
+                                                    ENamedThreads::Type CurrentThread,
+                                                    const FGraphEventRef& MyCompletionGraphEvent)
+{
+	if (Target)
+	{
+		Target->FlushQueuedMessages();
+	}
+}
+
+FString FGameplayMessageQueueTickFunction::DiagnosticMessage()
+{
+	return TEXT("FGameplayMessageQueueTickFunction");
+}
+
 //////////////////////////////////////////////////////////////////////
 // UGameplayMessageSubsystem
 
@@ -59,11 +123,179 @@ bool UGameplayMessageSubsystem::HasInstance(const UObject* WorldContextObject)
 
 void UGameplayMessageSubsystem::Deinitialize()
 {
+	if (QueueTickFunction.IsTickFunctionRegistered())
+	{
+		QueueTickFunction.UnRegisterTickFunction();
+	}
+	QueueTickWorld.Reset();
+
+	for (FMessageQueue& Queue : MessageQueues)
+	{
+		Queue.Reset();
+	}
+	QueuedMessageCoalescers.Reset();
+
 	ListenerMap.Reset();
+	DispatchCache.Reset();
+	PendingListeners.Reset();
+	bHasPendingRemovals = false;
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+	ChannelStats.Reset();
+#endif
 
 	Super::Deinitialize();
 }
 
+void UGameplayMessageSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	UGameplayMessageSubsystem* This = CastChecked<UGameplayMessageSubsystem>(InThis);
+
+	// Queued payloads may hold the only reference to their objects until they are flushed
+	for (FMessageQueue& Queue : This->MessageQueues)
+	{
+		for (TPair<const UScriptStruct*, FQueuedMessageArena>& Pair : Queue.Arenas)
+		{
+			for (int32 Index = 0; Index < Pair.Value.Channels.Num(); ++Index)
+			{
+				Collector.AddPropertyReferences(Pair.Key, Pair.Value.GetPayload(Index), This);
+			}
+		}
+	}
+
+	Super::AddReferencedObjects(InThis, Collector);
+}
+
+void UGameplayMessageSubsystem::FMessageQueue::Reset()
+{
+	for (TPair<const UScriptStruct*, FQueuedMessageArena>& Pair : Arenas)
+	{
+		FQueuedMessageArena& Arena = Pair.Value;
+		for (int32 Index = 0; Index < Arena.Channels.Num(); ++Index)
+		{
+			Pair.Key->DestroyStruct(Arena.GetPayload(Index));
+		}
+
+		Arena.Bytes.Reset();
+		Arena.Channels.Reset();
+		Arena.Stride = 0;
+	}
+
+	Messages.Reset();
+}
+
+void UGameplayMessageSubsystem::QueueMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType,
+                                                     const void* MessageBytes)
+{
+	if (!ensure(StructType && MessageBytes))
+	{
+		return;
+	}
+
+	FMessageQueue& Queue = MessageQueues[ActiveQueueIndex];
+	FQueuedMessageArena& Arena = Queue.Arenas.FindOrAdd(StructType);
+	if (Arena.Stride == 0)
+	{
+		check(StructType->GetMinAlignment() <= 16);
+		Arena.Stride = Align(StructType->GetStructureSize(), StructType->GetMinAlignment());
+	}
+
+	if (const FQueuedMessageCoalescer* Coalescer = QueuedMessageCoalescers.Find(Channel))
+	{
+		if (Coalescer->StructType == StructType)
+		{
+			for (int32 Index = 0; Index < Arena.Channels.Num(); ++Index)
+			{
+				if (Arena.Channels[Index] == Channel && Coalescer->Coalesce(Arena.GetPayload(Index), MessageBytes))
+				{
+					return;
+				}
+			}
+		}
+	}
+
+	const int32 ArenaIndex = Arena.Channels.Add(Channel);
+	Arena.Bytes.AddUninitialized(Arena.Stride);
+
+	void* Payload = Arena.GetPayload(ArenaIndex);
+	StructType->InitializeStruct(Payload);
+	StructType->CopyScriptStruct(Payload, MessageBytes);
+
+	Queue.Messages.Add({StructType, ArenaIndex});
+
+	RegisterQueueTickFunction();
+}
+
+void UGameplayMessageSubsystem::SetQueuedMessageCoalescerInternal(FGameplayTag Channel,
+                                                                  TFunction<bool(void*, const void*)>&& Coalescer,
+                                                                  const UScriptStruct* StructType)
+{
+	FQueuedMessageCoalescer& Entry = QueuedMessageCoalescers.FindOrAdd(Channel);
+	Entry.Coalesce = MoveTemp(Coalescer);
+	Entry.StructType = StructType;
+}
+
+void UGameplayMessageSubsystem::ClearQueuedMessageCoalescer(FGameplayTag Channel)
+{
+	QueuedMessageCoalescers.Remove(Channel);
+}
+
+void UGameplayMessageSubsystem::SetQueueFlushTickGroup(ETickingGroup TickGroup)
+{
+	QueueFlushTickGroup = TickGroup;
+	QueueTickFunction.TickGroup = TickGroup;
+	QueueTickFunction.EndTickGroup = TickGroup;
+}
+
+void UGameplayMessageSubsystem::RegisterQueueTickFunction()
+{
+	UWorld* World = GetGameInstance()->GetWorld();
+	if (QueueTickFunction.IsTickFunctionRegistered())
+	{
+		if (QueueTickWorld.Get() == World)
+		{
+			return;
+		}
+
+		QueueTickFunction.UnRegisterTickFunction();
+	}
+
+	// Without a world the messages stay queued until one is available or FlushQueuedMessages is called
+	if (!World || !World->PersistentLevel)
+	{
+		return;
+	}
+
+	QueueTickFunction.Target = this;
+	QueueTickFunction.bCanEverTick = true;
+	QueueTickFunction.bTickEvenWhenPaused = true;
+	QueueTickFunction.TickGroup = QueueFlushTickGroup;
+	QueueTickFunction.EndTickGroup = QueueFlushTickGroup;
+	QueueTickFunction.RegisterTickFunction(World->PersistentLevel);
+	QueueTickWorld = World;
+}
+
+void UGameplayMessageSubsystem::FlushQueuedMessages()
+{
+	FMessageQueue& Queue = MessageQueues[ActiveQueueIndex];
+	if (bIsFlushingQueue || Queue.Messages.IsEmpty())
+	{
+		return;
+	}
+
+	TGuardValue<bool> FlushGuard(bIsFlushingQueue, true);
+	ActiveQueueIndex ^= 1;
+
+	for (const FQueuedMessage& Message : Queue.Messages)
+	{
+		FQueuedMessageArena& Arena = Queue.Arenas.FindChecked(Message.StructType);
+		BroadcastMessageInternal(Arena.Channels[Message.ArenaIndex], Message.StructType,
+		                         Arena.GetPayload(Message.ArenaIndex));
+	}
+
+	Queue.Reset();
+}
+
 void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType,
                                                          const void* MessageBytes)
 {
@@ -86,52 +318,229 @@ void UGameplayMessageSubsystem::BroadcastMessageInternal(FGameplayTag Channel, c
 		       PContextString ? **PContextString : *GetPathNameSafe(this), *Channel.ToString(), *HumanReadableMessage);
 	}
 
+	SCOPE_CYCLE_COUNTER(STAT_GameplayMessages_Broadcast);
+	INC_DWORD_STAT(STAT_GameplayMessages_Broadcasts);
+	CSV_CUSTOM_STAT(GameplayMessages, Broadcasts, 1, ECsvCustomStatOp::Accumulate);
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+	// Accumulated locally, nested broadcasts may add to ChannelStats while listeners run
+	const bool bCollectStats = UE::GameplayMessageSubsystem::bCollectStats;
+	FGameplayMessageStats BroadcastStats;
+	BroadcastStats.BroadcastCount = 1;
+#endif
+
 	// Broadcast the message
-	bool bOnInitialTag = true;
-	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	// Iterate a view rather than the cached array itself: nested broadcasts may add entries to DispatchCache,
+	// which can move the array headers but never their allocations while BroadcastDepth is non-zero
+	const TConstArrayView<FChannelDispatchEntry> Entries = FindOrBuildDispatchList(Channel).Entries;
+
+	++BroadcastDepth;
+	for (const FChannelDispatchEntry& Entry : Entries)
 	{
-		if (const FChannelListenerList* pList = ListenerMap.Find(Tag))
+		FGameplayMessageListenerData& Listener = *Entry.Listener;
+		if (Listener.bPendingRemoval)
+		{
+			continue;
+		}
+
+		if (Listener.bHadValidType && !Listener.ListenerStructType.IsValid())
+		{
+			UE_LOG(LogGameplayMessageSubsystem, Warning,
+			       TEXT("Listener struct type has gone invalid on Channel %s. Removing listener from list"),
+			       *Channel.ToString());
+			UnregisterListenerInternal(Entry.ListenerChannel, Listener.HandleID);
+			continue;
+		}
+
+		// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use)
+		if (Listener.bHadValidType && !StructType->IsChildOf(Listener.ListenerStructType.Get()))
 		{
-			// Copy in case there are removals while handling callbacks
-			TArray<FGameplayMessageListenerData> ListenerArray(pList->Listeners);
+			UE_LOG(LogGameplayMessageSubsystem, Error,
+			       TEXT(
+				       "Struct type mismatch on channel %s (broadcast type %s, listener at %s was expecting type %s)"
+			       ),
+			       *Channel.ToString(),
+			       *StructType->GetPathName(),
+			       *Entry.ListenerChannel.ToString(),
+			       *Listener.ListenerStructType->GetPathName());
 
-			for (const FGameplayMessageListenerData& Listener : ListenerArray)
+			INC_DWORD_STAT(STAT_GameplayMessages_TypeMismatches);
+#if WITH_GAMEPLAY_MESSAGE_STATS
+			if (bCollectStats)
 			{
-				if (!bOnInitialTag && (Listener.MatchType != EGameplayMessageMatch::PartialMatch))
-				{
-					UE_LOG(LogGameplayMessageSubsystem, Warning,
-					       TEXT("Listener on channel %s is not a partial match, skipping"), *Channel.ToString());
-					continue;
-				}
+				++BroadcastStats.TypeMismatches;
+				++Listener.Stats.TypeMismatches;
+			}
+#endif
+			continue;
+		}
 
-				if (Listener.bHadValidType && !Listener.ListenerStructType.IsValid())
-				{
-					UE_LOG(LogGameplayMessageSubsystem, Warning,
-					       TEXT("Listener struct type has gone invalid on Channel %s. Removing listener from list"),
-					       *Channel.ToString());
-					UnregisterListenerInternal(Channel, Listener.HandleID);
-					continue;
-				}
+		INC_DWORD_STAT(STAT_GameplayMessages_ListenerInvocations);
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+		if (bCollectStats)
+		{
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Listener.ReceivedCallback(Channel, StructType, MessageBytes);
+			const uint64 CallbackCycles = FPlatformTime::Cycles64() - StartCycles;
+
+			BroadcastStats.AddCallback(CallbackCycles);
+			Listener.Stats.AddCallback(CallbackCycles);
+			continue;
+		}
+#endif
+
+		Listener.ReceivedCallback(Channel, StructType, MessageBytes);
+	}
+
+	if (--BroadcastDepth == 0)
+	{
+		FlushPendingListenerChanges();
+	}
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+	if (bCollectStats)
+	{
+		ChannelStats.FindOrAdd(Channel).Accumulate(BroadcastStats);
+
+#if CSV_PROFILER
+		if (FCsvProfiler::Get()->IsCapturing())
+		{
+			// Per-channel callback time, named after the channel tag
+			FCsvProfiler::RecordCustomStat(Channel.GetTagName(), CSV_CATEGORY_INDEX(GameplayMessages),
+			                               FPlatformTime::ToMilliseconds64(BroadcastStats.TotalCallbackCycles),
+			                               ECsvCustomStatOp::Accumulate);
+		}
+#endif
+	}
+#endif
+}
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+void UGameplayMessageSubsystem::DumpStats(FOutputDevice& Ar) const
+{
+	TArray<FGameplayTag> SortedChannels;
+	ChannelStats.GenerateKeyArray(SortedChannels);
+	SortedChannels.Sort([this](const FGameplayTag& A, const FGameplayTag& B)
+	{
+		return ChannelStats.FindChecked(A).TotalCallbackCycles > ChannelStats.FindChecked(B).TotalCallbackCycles;
+	});
+
+	Ar.Logf(TEXT("Gameplay message stats for %s (%d channels)"), *GetPathNameSafe(this), SortedChannels.Num());
+	for (const FGameplayTag& Channel : SortedChannels)
+	{
+		const FGameplayMessageStats& Stats = ChannelStats.FindChecked(Channel);
+		Ar.Logf(TEXT("  %s: Broadcasts=%lld Invocations=%lld Mismatches=%lld Total=%.3fms Max=%.3fms"),
+		        *Channel.ToString(), Stats.BroadcastCount, Stats.ListenerInvocations, Stats.TypeMismatches,
+		        FPlatformTime::ToMilliseconds64(Stats.TotalCallbackCycles),
+		        FPlatformTime::ToMilliseconds64(Stats.MaxCallbackCycles));
+	}
+
+	Ar.Logf(TEXT("Listeners"));
+	for (const TPair<FGameplayTag, FChannelListenerList>& Pair : ListenerMap)
+	{
+		for (const FGameplayMessageListenerData& Listener : Pair.Value.Listeners)
+		{
+			const FGameplayMessageStats& Stats = Listener.Stats;
+			Ar.Logf(TEXT("  %s #%d (%s, %s): Invocations=%lld Mismatches=%lld Total=%.3fms Max=%.3fms"),
+			        *Pair.Key.ToString(), Listener.HandleID,
+			        *GetNameSafe(Listener.ListenerStructType.Get()),
+			        Listener.MatchType == EGameplayMessageMatch::PartialMatch ? TEXT("Partial") : TEXT("Exact"),
+			        Stats.ListenerInvocations, Stats.TypeMismatches,
+			        FPlatformTime::ToMilliseconds64(Stats.TotalCallbackCycles),
+			        FPlatformTime::ToMilliseconds64(Stats.MaxCallbackCycles));
+		}
+	}
+}
+
+void UGameplayMessageSubsystem::ResetStats()
+{
+	ChannelStats.Reset();
+	for (TPair<FGameplayTag, FChannelListenerList>& Pair : ListenerMap)
+	{
+		for (FGameplayMessageListenerData& Listener : Pair.Value.Listeners)
+		{
+			Listener.Stats = FGameplayMessageStats();
+		}
+	}
+}
+#endif
+
+const UGameplayMessageSubsystem::FChannelDispatchList& UGameplayMessageSubsystem::FindOrBuildDispatchList(
+	FGameplayTag Channel)
+{
+	if (const FChannelDispatchList* CachedList = DispatchCache.Find(Channel))
+	{
+		return *CachedList;
+	}
+
+	FChannelDispatchList& NewList = DispatchCache.Add(Channel);
 
-				// The receiving type must be either a parent of the sending type or completely ambiguous (for internal use)
-				if (Listener.bHadValidType && !StructType->IsChildOf(Listener.ListenerStructType.Get()))
+	// Exact channel listeners first, then partial match listeners from each parent, same order as a tag walk
+	bool bOnInitialTag = true;
+	for (FGameplayTag Tag = Channel; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	{
+		if (FChannelListenerList* pList = ListenerMap.Find(Tag))
+		{
+			for (FGameplayMessageListenerData& Listener : pList->Listeners)
+			{
+				if (bOnInitialTag || Listener.MatchType == EGameplayMessageMatch::PartialMatch)
 				{
-					UE_LOG(LogGameplayMessageSubsystem, Error,
-					       TEXT(
-						       "Struct type mismatch on channel %s (broadcast type %s, listener at %s was expecting type %s)"
-					       ),
-					       *Channel.ToString(),
-					       *StructType->GetPathName(),
-					       *Tag.ToString(),
-					       *Listener.ListenerStructType->GetPathName());
-					continue;
+					NewList.Entries.Add({&Listener, Tag});
 				}
-
-				Listener.ReceivedCallback(Channel, StructType, MessageBytes);
 			}
 		}
 		bOnInitialTag = false;
 	}
+
+	return NewList;
+}
+
+void UGameplayMessageSubsystem::InvalidateDispatchCache(FGameplayTag Channel)
+{
+	check(BroadcastDepth == 0);
+
+	// Only broadcasts on Channel or its children can reach listeners registered on Channel
+	for (auto It = DispatchCache.CreateIterator(); It; ++It)
+	{
+		if (It->Key.MatchesTag(Channel))
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void UGameplayMessageSubsystem::FlushPendingListenerChanges()
+{
+	if (PendingListeners.IsEmpty() && !bHasPendingRemovals)
+	{
+		return;
+	}
+
+	for (FPendingListener& Pending : PendingListeners)
+	{
+		ListenerMap.FindOrAdd(Pending.Channel).Listeners.Add(MoveTemp(Pending.Data));
+	}
+	PendingListeners.Reset();
+
+	for (auto It = ListenerMap.CreateIterator(); It; ++It)
+	{
+		if (bHasPendingRemovals)
+		{
+			It->Value.Listeners.RemoveAllSwap([](const FGameplayMessageListenerData& Listener)
+			{
+				return Listener.bPendingRemoval;
+			});
+		}
+
+		if (It->Value.Listeners.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+	bHasPendingRemovals = false;
+
+	DispatchCache.Reset();
 }
 
 void UGameplayMessageSubsystem::K2_BroadcastMessage(FGameplayTag Channel, const int32& Message)
@@ -161,16 +570,30 @@ FGameplayMessageListenerHandle UGameplayMessageSubsystem::RegisterListenerIntern
 	const FGameplayTag Channel, TFunction<void(FGameplayTag, const UScriptStruct*, const void*)>&& Callback,
 	const UScriptStruct* StructType, EGameplayMessageMatch MatchType)
 {
+	// Adding a map entry never reallocates the listener arrays that in-flight broadcasts are iterating
 	auto& [Listeners, HandleID] = ListenerMap.FindOrAdd(Channel);
 
-	FGameplayMessageListenerData& Entry = Listeners.AddDefaulted_GetRef();
+	FGameplayMessageListenerData Entry;
 	Entry.ReceivedCallback = MoveTemp(Callback);
 	Entry.ListenerStructType = StructType;
 	Entry.bHadValidType = StructType != nullptr;
 	Entry.HandleID = ++HandleID;
 	Entry.MatchType = MatchType;
 
-	return FGameplayMessageListenerHandle(this, Channel, Entry.HandleID);
+	const FGameplayMessageListenerHandle Handle(this, Channel, Entry.HandleID);
+
+	if (BroadcastDepth > 0)
+	{
+		// New listeners don't receive the message currently being broadcast
+		PendingListeners.Add({Channel, MoveTemp(Entry)});
+	}
+	else
+	{
+		Listeners.Add(MoveTemp(Entry));
+		InvalidateDispatchCache(Channel);
+	}
+
+	return Handle;
 }
 
 void UGameplayMessageSubsystem::UnregisterListener(const FGameplayMessageListenerHandle& Handle)
@@ -187,6 +610,20 @@ void UGameplayMessageSubsystem::UnregisterListener(const FGameplayMessageListene
 
 void UGameplayMessageSubsystem::UnregisterListenerInternal(FGameplayTag Channel, int32 HandleID)
 {
+	if (BroadcastDepth > 0)
+	{
+		const int32 PendingIndex = PendingListeners.IndexOfByPredicate(
+			[Channel, ID = HandleID](const FPendingListener& Other)
+			{
+				return Other.Channel == Channel && Other.Data.HandleID == ID;
+			});
+		if (PendingIndex != INDEX_NONE)
+		{
+			PendingListeners.RemoveAtSwap(PendingIndex);
+			return;
+		}
+	}
+
 	FChannelListenerList* pList = ListenerMap.Find(Channel);
 	if (!pList)
 	{
@@ -195,6 +632,18 @@ void UGameplayMessageSubsystem::UnregisterListenerInternal(FGameplayTag Channel,
 
 	const int32 MatchIndex = pList->Listeners.IndexOfByPredicate(
 		[ID = HandleID](const FGameplayMessageListenerData& Other) { return Other.HandleID == ID; });
+
+	if (BroadcastDepth > 0)
+	{
+		// Broadcasts in flight hold pointers into this array, compact once they have all returned
+		if (MatchIndex != INDEX_NONE)
+		{
+			pList->Listeners[MatchIndex].bPendingRemoval = true;
+			bHasPendingRemovals = true;
+		}
+		return;
+	}
+
 	if (MatchIndex != INDEX_NONE)
 	{
 		pList->Listeners.RemoveAtSwap(MatchIndex);
@@ -204,4 +653,6 @@ void UGameplayMessageSubsystem::UnregisterListenerInternal(FGameplayTag Channel,
 	{
 		ListenerMap.Remove(Channel);
 	}
+
+	InvalidateDispatchCache(Channel);
 }
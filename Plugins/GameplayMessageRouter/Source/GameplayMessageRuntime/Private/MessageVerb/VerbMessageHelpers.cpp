@@ -84,3 +84,16 @@ FVerbMessage UVerbMessageHelpers::CueParametersToVerbMessage(const FGameplayCueP
 
 	return Result;
 }
+
+bool UVerbMessageHelpers::CoalesceMagnitudeByTarget(FVerbMessage& QueuedMessage, const FVerbMessage& IncomingMessage)
+{
+	if (QueuedMessage.Verb != IncomingMessage.Verb ||
+		QueuedMessage.Instigator != IncomingMessage.Instigator ||
+		QueuedMessage.Target != IncomingMessage.Target)
+	{
+		return false;
+	}
+
+	QueuedMessage.Magnitude += IncomingMessage.Magnitude;
+	return true;
+}
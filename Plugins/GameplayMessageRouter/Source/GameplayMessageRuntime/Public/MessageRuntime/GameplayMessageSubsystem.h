@@ -3,6 +3,7 @@
 #pragma once
 
 #include "MessageRuntime/GameplayMessageTypes2.h"
+#include "Engine/EngineBaseTypes.h"
 #include "GameplayTagContainer.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "UObject/WeakObjectPtr.h"
@@ -14,6 +15,40 @@ struct FFrame;
 
 GAMEPLAYMESSAGERUNTIME_API DECLARE_LOG_CATEGORY_EXTERN(LogGameplayMessageSubsystem, Log, All);
 
+#ifndef WITH_GAMEPLAY_MESSAGE_STATS
+#define WITH_GAMEPLAY_MESSAGE_STATS !UE_BUILD_SHIPPING
+#endif
+
+/**
+ * Counters collected per channel and per listener, see GameplayMessageSubsystem.DumpStats
+ */
+struct FGameplayMessageStats
+{
+	int64 BroadcastCount = 0;
+	int64 ListenerInvocations = 0;
+	int64 TypeMismatches = 0;
+
+	// Cumulative and slowest single listener callback time
+	uint64 TotalCallbackCycles = 0;
+	uint64 MaxCallbackCycles = 0;
+
+	void Accumulate(const FGameplayMessageStats& Other)
+	{
+		BroadcastCount += Other.BroadcastCount;
+		ListenerInvocations += Other.ListenerInvocations;
+		TypeMismatches += Other.TypeMismatches;
+		TotalCallbackCycles += Other.TotalCallbackCycles;
+		MaxCallbackCycles = FMath::Max(MaxCallbackCycles, Other.MaxCallbackCycles);
+	}
+
+	void AddCallback(uint64 Cycles)
+	{
+		++ListenerInvocations;
+		TotalCallbackCycles += Cycles;
+		MaxCallbackCycles = FMath::Max(MaxCallbackCycles, Cycles);
+	}
+};
+
 class UAsyncAction_ListenForGameplayMessage;
 
 /**
@@ -70,6 +105,25 @@ struct FGameplayMessageListenerData
 	// Adding some logging and extra variables around some potential problems with this
 	TWeakObjectPtr<const UScriptStruct> ListenerStructType = nullptr;
 	bool bHadValidType = false;
+
+	// Set when the listener is unregistered while a broadcast is in flight; the entry is compacted away afterwards
+	bool bPendingRemoval = false;
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+	FGameplayMessageStats Stats;
+#endif
+};
+
+/**
+ * Tick function that flushes messages queued with UGameplayMessageSubsystem::QueueMessage
+ */
+struct FGameplayMessageQueueTickFunction : public FTickFunction
+{
+	UGameplayMessageSubsystem* Target = nullptr;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread,
+	                         const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
 };
 
 /**
@@ -108,6 +162,8 @@ public:
 	virtual void Deinitialize() override;
 	//~End of USubsystem interface
 
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	/**
 	 * Broadcast a message on the specified channel
 	 *
@@ -121,6 +177,58 @@ public:
 		BroadcastMessageInternal(Channel, StructType, &Message);
 	}
 
+	/**
+	 * Queue a message to be broadcast on the specified channel when the queue is next flushed
+	 * The payload is copied, so the caller doesn't need to keep it alive. Listeners are called from the flush
+	 * tick (see SetQueueFlushTickGroup) instead of inside the caller.
+	 *
+	 * @param Channel			The message channel to broadcast on
+	 * @param Message			The message to send (must be the same type of UScriptStruct expected by the listeners for this channel, otherwise an error will be logged)
+	 */
+	template <typename FMessageStructType>
+	void QueueMessage(FGameplayTag Channel, const FMessageStructType& Message)
+	{
+		const UScriptStruct* StructType = TBaseStructure<FMessageStructType>::Get();
+		QueueMessageInternal(Channel, StructType, &Message);
+	}
+
+	/**
+	 * Fold messages queued on a channel into each other instead of dispatching each one
+	 *
+	 * @param Channel			The exact channel to coalesce
+	 * @param Coalescer			Called with an already queued message and the incoming one, returns true if the incoming message was merged into the queued one
+	 */
+	template <typename FMessageStructType>
+	void SetQueuedMessageCoalescer(FGameplayTag Channel,
+	                               TFunction<bool(FMessageStructType&, const FMessageStructType&)>&& Coalescer)
+	{
+		auto ThunkCoalescer = [InnerCoalescer = MoveTemp(Coalescer)](void* QueuedPayload, const void* IncomingPayload)
+		{
+			return InnerCoalescer(*static_cast<FMessageStructType*>(QueuedPayload),
+			                      *static_cast<const FMessageStructType*>(IncomingPayload));
+		};
+
+		const UScriptStruct* StructType = TBaseStructure<FMessageStructType>::Get();
+		SetQueuedMessageCoalescerInternal(Channel, ThunkCoalescer, StructType);
+	}
+
+	/** Stop coalescing messages queued on the specified channel */
+	void ClearQueuedMessageCoalescer(FGameplayTag Channel);
+
+	/** Change the tick group queued messages are flushed in (TG_PostUpdateWork by default) */
+	void SetQueueFlushTickGroup(ETickingGroup TickGroup);
+
+	/** Broadcast every queued message now, in the order they were queued */
+	void FlushQueuedMessages();
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+	/** Write per-channel and per-listener counters to Ar, hottest channels first */
+	void DumpStats(FOutputDevice& Ar) const;
+
+	/** Clear all per-channel and per-listener counters */
+	void ResetStats();
+#endif
+
 	/**
 	 * Register to receive messages on a specified channel
 	 *
@@ -235,6 +343,17 @@ private:
 
 	void UnregisterListenerInternal(FGameplayTag Channel, int32 HandleID);
 
+	// Internal helper for copying a message into the active queue
+	void QueueMessageInternal(FGameplayTag Channel, const UScriptStruct* StructType, const void* MessageBytes);
+
+	// Internal helper for registering a queued message coalescer
+	void SetQueuedMessageCoalescerInternal(FGameplayTag Channel,
+	                                       TFunction<bool(void*, const void*)>&& Coalescer,
+	                                       const UScriptStruct* StructType);
+
+	// Registers the flush tick function with the game instance's current world if needed
+	void RegisterQueueTickFunction();
+
 	// List of all entries for a given channel
 	struct FChannelListenerList
 	{
@@ -242,5 +361,93 @@ private:
 		int32 HandleID = 0;
 	};
 
+	// A single listener that should receive broadcasts on a cached channel
+	struct FChannelDispatchEntry
+	{
+		FGameplayMessageListenerData* Listener = nullptr;
+
+		// Channel the listener registered on (a parent of the broadcast channel for partial matches)
+		FGameplayTag ListenerChannel;
+	};
+
+	// Flattened exact and partial match listeners for one broadcast channel, in dispatch order
+	struct FChannelDispatchList
+	{
+		TArray<FChannelDispatchEntry> Entries;
+	};
+
+	// A listener registered while a broadcast was in flight, added once the outermost broadcast returns
+	struct FPendingListener
+	{
+		FGameplayTag Channel;
+		FGameplayMessageListenerData Data;
+	};
+
+	// Returns the cached dispatch list for a channel, building it on first use
+	const FChannelDispatchList& FindOrBuildDispatchList(FGameplayTag Channel);
+
+	// Drops cached dispatch lists that could include listeners registered on Channel
+	void InvalidateDispatchCache(FGameplayTag Channel);
+
+	// Applies registrations and removals that were deferred while broadcasting
+	void FlushPendingListenerChanges();
+
+	// Copies of queued payloads that share a struct type, stored back to back
+	struct FQueuedMessageArena
+	{
+		TArray<uint8, TAlignedHeapAllocator<16>> Bytes;
+		TArray<FGameplayTag> Channels;
+		int32 Stride = 0;
+
+		void* GetPayload(int32 Index) { return Bytes.GetData() + Index * Stride; }
+	};
+
+	// Order in which queued messages are dispatched
+	struct FQueuedMessage
+	{
+		const UScriptStruct* StructType = nullptr;
+		int32 ArenaIndex = INDEX_NONE;
+	};
+
+	struct FMessageQueue
+	{
+		TArray<FQueuedMessage> Messages;
+		TMap<const UScriptStruct*, FQueuedMessageArena> Arenas;
+
+		// Destroys every payload, keeping the allocations for the next frame
+		void Reset();
+	};
+
+	struct FQueuedMessageCoalescer
+	{
+		TFunction<bool(void*, const void*)> Coalesce;
+		const UScriptStruct* StructType = nullptr;
+	};
+
 	TMap<FGameplayTag, FChannelListenerList> ListenerMap;
+
+	// Dispatch lists point into ListenerMap storage, so they are only valid until the next register/unregister
+	TMap<FGameplayTag, FChannelDispatchList> DispatchCache;
+
+	TArray<FPendingListener> PendingListeners;
+
+	// Number of broadcasts currently on the stack; listener storage is not mutated while this is non-zero
+	int32 BroadcastDepth = 0;
+
+	bool bHasPendingRemovals = false;
+
+	// Double buffered so messages queued by listeners during a flush go out in the next one
+	FMessageQueue MessageQueues[2];
+	int32 ActiveQueueIndex = 0;
+	bool bIsFlushingQueue = false;
+
+	TMap<FGameplayTag, FQueuedMessageCoalescer> QueuedMessageCoalescers;
+
+#if WITH_GAMEPLAY_MESSAGE_STATS
+	TMap<FGameplayTag, FGameplayMessageStats> ChannelStats;
+#endif
+
+	FGameplayMessageQueueTickFunction QueueTickFunction;
+	TWeakObjectPtr<UWorld> QueueTickWorld;
+	ETickingGroup QueueFlushTickGroup = TG_PostUpdateWork;
 };
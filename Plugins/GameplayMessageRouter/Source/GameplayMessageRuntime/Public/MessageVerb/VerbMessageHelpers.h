@@ -33,4 +33,10 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Helpers")
 	static FVerbMessage CueParametersToVerbMessage(const FGameplayCueParameters& Params);
+
+	/**
+	 * Queued message coalescer that sums the Magnitude of messages sharing a verb, instigator and target
+	 * @see UGameplayMessageSubsystem::SetQueuedMessageCoalescer
+	 */
+	static bool CoalesceMagnitudeByTarget(FVerbMessage& QueuedMessage, const FVerbMessage& IncomingMessage);
 };
@@ -0,0 +1,99 @@
+#include "Commandlets/StructuredLogDecodeCommandlet.h"
+
+#include "HAL/FileManager.h"
+#include "Log/StructuredLog.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(StructuredLogDecodeCommandlet)
+
+namespace
+{
+	FString EscapeJson(const FString& Value)
+	{
+		FString Result;
+		Result.Reserve(Value.Len() + 2);
+		for (const TCHAR Char : Value)
+		{
+			switch (Char)
+			{
+			case TEXT('"'): Result += TEXT("\\\"");
+				break;
+			case TEXT('\\'): Result += TEXT("\\\\");
+				break;
+			case TEXT('\n'): Result += TEXT("\\n");
+				break;
+			case TEXT('\r'): Result += TEXT("\\r");
+				break;
+			case TEXT('\t'): Result += TEXT("\\t");
+				break;
+			default:
+				if (Char < 0x20) Result += FString::Printf(TEXT("\\u%04x"), static_cast<uint32>(Char));
+				else Result.AppendChar(Char);
+				break;
+			}
+		}
+		return Result;
+	}
+}
+
+UStructuredLogDecodeCommandlet::UStructuredLogDecodeCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UStructuredLogDecodeCommandlet::Main(const FString& Params)
+{
+	FString InputFile;
+	if (!FParse::Value(*Params, TEXT("Input="), InputFile))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: -run=StructuredLogDecode -Input=<File.slog> [-Output=<File>] [-Json]"));
+		return 1;
+	}
+
+	const bool bJson = FParse::Param(*Params, TEXT("Json"));
+	FString OutputFile;
+	if (!FParse::Value(*Params, TEXT("Output="), OutputFile))
+	{
+		OutputFile = FPaths::ChangeExtension(InputFile, bJson ? TEXT("jsonl") : TEXT("log"));
+	}
+
+	TUniquePtr<FArchive> Output(IFileManager::Get().CreateFileWriter(*OutputFile));
+	if (!Output)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Could not open %s for writing"), *OutputFile);
+		return 1;
+	}
+
+	int32 NumEntries = 0;
+	FString Error;
+	const bool bDecoded = UE::Logger::DecodeStructuredLog(InputFile, [&](const UE::Logger::FStructuredLogEntry& Entry)
+	{
+		const FString Line = bJson
+			                     ? FString::Printf(
+				                     TEXT("{\"time\":\"%s\",\"thread\":%u,\"threadName\":\"%s\",\"category\":\"%s\",\"verbosity\":\"%s\",\"site\":\"%s\",\"line\":%d,\"file\":\"%s\",\"message\":\"%s\"}\n"),
+				                     *Entry.Time.ToIso8601(), Entry.ThreadId, *EscapeJson(Entry.ThreadName),
+				                     *Entry.Category.ToString(), ToString(Entry.Verbosity), *EscapeJson(Entry.CallSite),
+				                     Entry.Line, *EscapeJson(Entry.File), *EscapeJson(Entry.Message))
+			                     : FString::Printf(TEXT("[%s][%s]%s: %s: %s:%d : %s\n"),
+			                                       *Entry.Time.ToString(TEXT("%Y.%m.%d-%H.%M.%S:%s")),
+			                                       Entry.ThreadName.IsEmpty() ? *FString::FromInt(Entry.ThreadId) : *Entry.ThreadName,
+			                                       *Entry.Category.ToString(), ToString(Entry.Verbosity), *Entry.CallSite,
+			                                       Entry.Line, *Entry.Message);
+
+		const FTCHARToUTF8 Converted(*Line);
+		Output->Serialize(const_cast<ANSICHAR*>(Converted.Get()), Converted.Length());
+		++NumEntries;
+	}, Error);
+
+	if (!bDecoded)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Decoding %s failed after %d entries: %s"), *InputFile, NumEntries, *Error);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Decoded %d entries from %s into %s"), NumEntries, *InputFile, *OutputFile);
+	return 0;
+}
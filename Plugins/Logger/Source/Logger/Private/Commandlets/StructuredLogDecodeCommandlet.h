@@ -0,0 +1,21 @@
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "StructuredLogDecodeCommandlet.generated.h"
+
+/**
+ * Decodes a binary .slog capture back to text or JSON lines.
+ *
+ * Usage: -run=StructuredLogDecode -Input=<File.slog> [-Output=<File>] [-Json]
+ * Output defaults to the input path with a .log (or .jsonl) extension.
+ */
+UCLASS()
+class UStructuredLogDecodeCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UStructuredLogDecodeCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
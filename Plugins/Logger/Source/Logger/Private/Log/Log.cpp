@@ -8,7 +8,48 @@ DEFINE_LOG_CATEGORY (LogCORE);
 DEFINE_LOG_CATEGORY (LogExperience);
 
 
-FString GetClientServerContext(UObject* ContextObject)
+FString UE::Logger::MakeCallSiteName(const ANSICHAR* Signature)
+{
+	const FAnsiStringView Full(Signature);
+
+	// Parameter list starts at the first '(' outside of template arguments; "(anonymous namespace)" is skipped
+	int32 ParamsStart = Full.Len();
+	int32 TemplateDepth = 0;
+	for (int32 Index = 0; Index < Full.Len(); ++Index)
+	{
+		const ANSICHAR Char = Full[Index];
+		if (Char == '<') ++TemplateDepth;
+		else if (Char == '>') --TemplateDepth;
+		else if (Char == '(' && TemplateDepth == 0 && !Full.RightChop(Index).StartsWith("(anonymous"))
+		{
+			ParamsStart = Index;
+			break;
+		}
+	}
+
+	// Return type ends at the last space before the name, outside of template arguments
+	int32 NameStart = 0;
+	TemplateDepth = 0;
+	for (int32 Index = ParamsStart - 1; Index >= 0; --Index)
+	{
+		const ANSICHAR Char = Full[Index];
+		if (Char == '>') ++TemplateDepth;
+		else if (Char == '<') --TemplateDepth;
+		else if (Char == ' ' && TemplateDepth == 0)
+		{
+			NameStart = Index + 1;
+			break;
+		}
+	}
+
+	// e.g. MSVC's "UFoo::Bar::<lambda_1>::operator ()": keep the whole signature rather than an empty name
+	const FAnsiStringView Name = Full.Mid(NameStart, ParamsStart - NameStart);
+	return FString(Name.IsEmpty() ? Full : Name);
+}
+
+FString GetClientServerContext(UObject* ContextObject) { return GetClientServerContextName(ContextObject); }
+
+const TCHAR* GetClientServerContextName(const UObject* ContextObject)
 {
 	ENetRole Role = ROLE_None;
 
@@ -23,7 +64,7 @@ FString GetClientServerContext(UObject* ContextObject)
 	if (GIsEditor)
 	{
 		extern ENGINE_API FString GPlayInEditorContextString;
-		return GPlayInEditorContextString;
+		return *GPlayInEditorContextString;
 	}
 #endif
 
@@ -0,0 +1,724 @@
+#include "Log/StructuredLog.h"
+
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadManager.h"
+#include "Misc/App.h"
+#include "Misc/Paths.h"
+
+namespace UE::Logger
+{
+	std::atomic<bool> FStructuredLogSink::bCapturing(false);
+
+	namespace
+	{
+		constexpr uint32 FileMagic = 0x474F4C53; // "SLOG"
+		constexpr uint32 FileVersion = 1;
+
+		enum class ERecordType : uint8
+		{
+			Site = 1,
+			Thread = 2,
+			Event = 3,
+			Dropped = 4
+		};
+
+		/* Ring record header: SiteId, Cycles64, PayloadSize. */
+		constexpr uint32 EventHeaderSize = sizeof(uint32) + sizeof(uint64) + sizeof(uint32);
+
+		int32 BufferSizeKB = 256;
+		FAutoConsoleVariableRef CVarBufferSizeKB(
+			TEXT("Logger.StructuredLog.BufferSizeKB"),
+			BufferSizeKB,
+			TEXT("Size of each thread's structured log ring buffer, applied when a thread first logs."),
+			ECVF_Default);
+
+		float FlushInterval = 0.1f;
+		FAutoConsoleVariableRef CVarFlushInterval(
+			TEXT("Logger.StructuredLog.FlushInterval"),
+			FlushInterval,
+			TEXT("Seconds between structured log buffer flushes."),
+			ECVF_Default);
+
+		/*
+		 * Single producer (the owning thread) / single consumer (the writer thread) byte ring.
+		 * Buffers live for the whole process so a thread never writes into freed memory when a capture stops.
+		 */
+		struct FThreadBuffer
+		{
+			FThreadBuffer(const uint32 InThreadId, const uint32 InCapacity)
+				: ThreadId(InThreadId), Capacity(InCapacity)
+			{
+				Data.SetNumUninitialized(Capacity);
+			}
+
+			void CopyIn(const uint64 Position, const uint8* Bytes, const uint32 Size)
+			{
+				const uint32 Offset = static_cast<uint32>(Position & (Capacity - 1));
+				const uint32 FirstPart = FMath::Min(Size, Capacity - Offset);
+				FMemory::Memcpy(Data.GetData() + Offset, Bytes, FirstPart);
+				if (FirstPart < Size) FMemory::Memcpy(Data.GetData(), Bytes + FirstPart, Size - FirstPart);
+			}
+
+			void CopyOut(const uint64 Position, uint8* Bytes, const uint32 Size) const
+			{
+				const uint32 Offset = static_cast<uint32>(Position & (Capacity - 1));
+				const uint32 FirstPart = FMath::Min(Size, Capacity - Offset);
+				FMemory::Memcpy(Bytes, Data.GetData() + Offset, FirstPart);
+				if (FirstPart < Size) FMemory::Memcpy(Bytes + FirstPart, Data.GetData(), Size - FirstPart);
+			}
+
+			void Write(const uint32 SiteId, const uint8* Payload, const uint32 PayloadSize)
+			{
+				const uint32 RecordSize = EventHeaderSize + PayloadSize;
+				const uint64 WritePos = Head.load(std::memory_order_relaxed);
+				if (Capacity - (WritePos - Tail.load(std::memory_order_acquire)) < RecordSize)
+				{
+					Dropped.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				const uint64 Cycles = FPlatformTime::Cycles64();
+				CopyIn(WritePos, reinterpret_cast<const uint8*>(&SiteId), sizeof(SiteId));
+				CopyIn(WritePos + 4, reinterpret_cast<const uint8*>(&Cycles), sizeof(Cycles));
+				CopyIn(WritePos + 12, reinterpret_cast<const uint8*>(&PayloadSize), sizeof(PayloadSize));
+				CopyIn(WritePos + EventHeaderSize, Payload, PayloadSize);
+				Head.store(WritePos + RecordSize, std::memory_order_release);
+			}
+
+			/* Appends all published records to Out. Consumer side only. */
+			void Drain(TArray<uint8>& Out)
+			{
+				const uint64 ReadPos = Tail.load(std::memory_order_relaxed);
+				const uint64 WritePos = Head.load(std::memory_order_acquire);
+				const uint32 Size = static_cast<uint32>(WritePos - ReadPos);
+				if (Size == 0) return;
+
+				const int32 Start = Out.AddUninitialized(Size);
+				CopyOut(ReadPos, Out.GetData() + Start, Size);
+				Tail.store(WritePos, std::memory_order_release);
+			}
+
+			/* Forgets everything written before a new capture starts. Consumer side only. */
+			void Discard()
+			{
+				Tail.store(Head.load(std::memory_order_acquire), std::memory_order_release);
+				Dropped.store(0, std::memory_order_relaxed);
+			}
+
+			const uint32 ThreadId;
+			const uint32 Capacity;
+			TArray<uint8> Data;
+			std::atomic<uint64> Head{0};
+			std::atomic<uint64> Tail{0};
+			std::atomic<uint32> Dropped{0};
+		};
+
+		FCriticalSection RegistryLock;
+		TArray<const FStructuredLogSite*> Sites;
+		TArray<FThreadBuffer*> ThreadBuffers;
+
+		thread_local FThreadBuffer* LocalThreadBuffer = nullptr;
+
+		FThreadBuffer& GetThreadBuffer()
+		{
+			if (!LocalThreadBuffer)
+			{
+				const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(BufferSizeKB, 4) * 1024);
+				LocalThreadBuffer = new FThreadBuffer(FPlatformTLS::GetCurrentThreadId(), Capacity);
+
+				FScopeLock Lock(&RegistryLock);
+				ThreadBuffers.Add(LocalThreadBuffer);
+			}
+			return *LocalThreadBuffer;
+		}
+
+		void WriteString(FArchive& Ar, const TCHAR* Value)
+		{
+			const FTCHARToUTF8 Converted(Value ? Value : TEXT(""));
+			uint32 Length = Converted.Length();
+			Ar << Length;
+			Ar.Serialize(const_cast<ANSICHAR*>(Converted.Get()), Length);
+		}
+
+		FString ReadString(FArchive& Ar)
+		{
+			uint32 Length = 0;
+			Ar << Length;
+			if (Ar.IsError() || Length > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				return FString();
+			}
+
+			TArray<UTF8CHAR> Bytes;
+			Bytes.SetNumUninitialized(Length);
+			Ar.Serialize(Bytes.GetData(), Length);
+			return FString(Length, Bytes.GetData());
+		}
+
+		/* Background writer draining the thread buffers into the capture file. */
+		class FStructuredLogWriter : public FRunnable
+		{
+		public:
+			FStructuredLogWriter(FArchive* InFile, const FString& InFilename)
+				: File(InFile), Filename(InFilename)
+			{
+				WakeEvent = FPlatformProcess::GetSynchEventFromPool();
+
+				uint32 Magic = FileMagic;
+				uint32 Version = FileVersion;
+				uint64 StartCycles = FPlatformTime::Cycles64();
+				int64 StartTicks = FDateTime::UtcNow().GetTicks();
+				double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+				*File << Magic << Version << StartCycles << StartTicks << SecondsPerCycle;
+
+				FScopeLock Lock(&RegistryLock);
+				for (FThreadBuffer* Buffer : ThreadBuffers) { Buffer->Discard(); }
+			}
+
+			virtual ~FStructuredLogWriter() override
+			{
+				FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+				delete File;
+			}
+
+			virtual uint32 Run() override
+			{
+				while (!bStopRequested.load(std::memory_order_acquire))
+				{
+					WakeEvent->Wait(FTimespan::FromSeconds(FMath::Max(FlushInterval, 0.001f)));
+					FlushOnce();
+				}
+				FlushOnce();
+				return 0;
+			}
+
+			virtual void Stop() override
+			{
+				bStopRequested.store(true, std::memory_order_release);
+				WakeEvent->Trigger();
+			}
+
+			void Wake() const { WakeEvent->Trigger(); }
+
+			const FString& GetFilename() const { return Filename; }
+
+		private:
+			void FlushOnce()
+			{
+				TArray<FThreadBuffer*> Buffers;
+				{
+					FScopeLock Lock(&RegistryLock);
+					Buffers = ThreadBuffers;
+				}
+
+				// Drain first: a site is always registered before its first event is published, so every site an
+				// event below refers to is visible once the registry is read afterwards
+				TArray<uint8> Staging;
+				TArray<TPair<int32, int32>, TInlineAllocator<16>> StagedRanges;
+				for (FThreadBuffer* Buffer : Buffers)
+				{
+					const int32 Start = Staging.Num();
+					Buffer->Drain(Staging);
+					StagedRanges.Emplace(Start, Staging.Num());
+				}
+
+				WriteNewSites();
+				WriteNewThreads(Buffers);
+
+				for (int32 BufferIndex = 0; BufferIndex < Buffers.Num(); ++BufferIndex)
+				{
+					uint32 ThreadId = Buffers[BufferIndex]->ThreadId;
+					for (int32 Offset = StagedRanges[BufferIndex].Key; Offset < StagedRanges[BufferIndex].Value;)
+					{
+						uint32 PayloadSize = 0;
+						FMemory::Memcpy(&PayloadSize, Staging.GetData() + Offset + 12, sizeof(PayloadSize));
+
+						uint8 Type = static_cast<uint8>(ERecordType::Event);
+						*File << Type << ThreadId;
+						File->Serialize(Staging.GetData() + Offset, EventHeaderSize + PayloadSize);
+						Offset += EventHeaderSize + PayloadSize;
+					}
+
+					if (uint32 NumDropped = Buffers[BufferIndex]->Dropped.exchange(0, std::memory_order_relaxed))
+					{
+						uint8 Type = static_cast<uint8>(ERecordType::Dropped);
+						uint64 Cycles = FPlatformTime::Cycles64();
+						*File << Type << ThreadId << Cycles << NumDropped;
+					}
+				}
+
+				File->Flush();
+			}
+
+			void WriteNewSites()
+			{
+				FScopeLock Lock(&RegistryLock);
+				for (; NumWrittenSites < Sites.Num(); ++NumWrittenSites)
+				{
+					const FStructuredLogSite& Site = *Sites[NumWrittenSites];
+					uint8 Type = static_cast<uint8>(ERecordType::Site);
+					uint32 Id = Site.Id;
+					uint8 Verbosity = static_cast<uint8>(Site.Verbosity);
+					int32 Line = Site.Line;
+					*File << Type << Id << Verbosity << Line;
+					WriteString(*File, *Site.Category.ToString());
+					WriteString(*File, Site.Format);
+					WriteString(*File, Site.CallSite);
+					WriteString(*File, ANSI_TO_TCHAR(Site.File));
+				}
+			}
+
+			void WriteNewThreads(const TArray<FThreadBuffer*>& Buffers)
+			{
+				for (; NumWrittenThreads < Buffers.Num(); ++NumWrittenThreads)
+				{
+					uint8 Type = static_cast<uint8>(ERecordType::Thread);
+					uint32 ThreadId = Buffers[NumWrittenThreads]->ThreadId;
+					*File << Type << ThreadId;
+					WriteString(*File, *FThreadManager::GetThreadName(ThreadId));
+				}
+			}
+
+			FArchive* File;
+			FString Filename;
+			FEvent* WakeEvent = nullptr;
+			std::atomic<bool> bStopRequested{false};
+			int32 NumWrittenSites = 0;
+			int32 NumWrittenThreads = 0;
+		};
+
+		FCriticalSection SessionLock;
+		FStructuredLogWriter* Writer = nullptr;
+		FRunnableThread* WriterThread = nullptr;
+
+		/* Printf-style formatting of decoded arguments, since FString::Printf only takes literal formats. */
+		struct FDecodedArg
+		{
+			EStructuredArgType Type = EStructuredArgType::Int32;
+			int64 Signed = 0;
+			uint64 Unsigned = 0;
+			double Double = 0.0;
+			FString String;
+		};
+
+		FString FormatDecodedMessage(const FString& Format, const TArray<FDecodedArg>& Args)
+		{
+			FString Result;
+			Result.Reserve(Format.Len() + Args.Num() * 8);
+
+			int32 ArgIndex = 0;
+			const TCHAR* Char = *Format;
+			while (*Char)
+			{
+				if (*Char != TEXT('%'))
+				{
+					Result.AppendChar(*Char++);
+					continue;
+				}
+				if (*++Char == TEXT('%'))
+				{
+					Result.AppendChar(*Char++);
+					continue;
+				}
+
+				bool bLeftAlign = false;
+				bool bZeroPad = false;
+				for (; *Char == TEXT('-') || *Char == TEXT('+') || *Char == TEXT(' ') || *Char == TEXT('0') || *Char == TEXT('#'); ++Char)
+				{
+					bLeftAlign |= *Char == TEXT('-');
+					bZeroPad |= *Char == TEXT('0');
+				}
+
+				int32 Width = 0;
+				for (; FChar::IsDigit(*Char); ++Char) Width = Width * 10 + (*Char - TEXT('0'));
+
+				int32 Precision = -1;
+				if (*Char == TEXT('.'))
+				{
+					Precision = 0;
+					for (++Char; FChar::IsDigit(*Char); ++Char) Precision = Precision * 10 + (*Char - TEXT('0'));
+				}
+
+				while (*Char == TEXT('h') || *Char == TEXT('l') || *Char == TEXT('L') || *Char == TEXT('z') || *Char == TEXT('j')
+					|| *Char == TEXT('t') || *Char == TEXT('I') || *Char == TEXT('6') || *Char == TEXT('4'))
+				{
+					++Char;
+				}
+
+				const TCHAR Conversion = *Char;
+				if (Conversion) ++Char;
+
+				if (!Args.IsValidIndex(ArgIndex))
+				{
+					Result += TEXT("<missing>");
+					continue;
+				}
+
+				const FDecodedArg& Arg = Args[ArgIndex++];
+				const bool bIsSigned = Arg.Type == EStructuredArgType::Int32 || Arg.Type == EStructuredArgType::Int64;
+				const uint64 AsUnsigned = bIsSigned ? static_cast<uint64>(Arg.Signed) : Arg.Unsigned;
+				const int64 AsSigned = bIsSigned ? Arg.Signed : static_cast<int64>(Arg.Unsigned);
+
+				FString Value;
+				switch (Conversion)
+				{
+				case TEXT('d'):
+				case TEXT('i'):
+					Value = Arg.Type == EStructuredArgType::Double ? FString::Printf(TEXT("%lld"), static_cast<int64>(Arg.Double)) : FString::Printf(TEXT("%lld"), AsSigned);
+					break;
+				case TEXT('u'):
+					Value = FString::Printf(TEXT("%llu"), AsUnsigned);
+					break;
+				case TEXT('x'):
+					Value = FString::Printf(TEXT("%llx"), AsUnsigned);
+					break;
+				case TEXT('X'):
+					Value = FString::Printf(TEXT("%llX"), AsUnsigned);
+					break;
+				case TEXT('c'):
+					Value.AppendChar(static_cast<TCHAR>(AsUnsigned));
+					break;
+				case TEXT('p'):
+					Value = FString::Printf(TEXT("0x%016llx"), AsUnsigned);
+					break;
+				case TEXT('e'):
+				case TEXT('E'):
+					Value = FString::Printf(TEXT("%.*e"), Precision < 0 ? 6 : Precision, Arg.Double);
+					break;
+				case TEXT('g'):
+				case TEXT('G'):
+					Value = FString::Printf(TEXT("%.*g"), Precision < 0 ? 6 : Precision, Arg.Double);
+					break;
+				case TEXT('f'):
+				case TEXT('F'):
+					Value = FString::Printf(TEXT("%.*f"), Precision < 0 ? 6 : Precision, Arg.Type == EStructuredArgType::Double ? Arg.Double : static_cast<double>(AsSigned));
+					break;
+				case TEXT('s'):
+				case TEXT('S'):
+					Value = Precision >= 0 ? Arg.String.Left(Precision) : Arg.String;
+					break;
+				default:
+					Value = TEXT("<?>");
+					break;
+				}
+
+				if (Value.Len() < Width)
+				{
+					const int32 Padding = Width - Value.Len();
+					if (bLeftAlign) Value += FString::ChrN(Padding, TEXT(' '));
+					else if (bZeroPad && Conversion != TEXT('s') && (Value.StartsWith(TEXT("-")) || Value.StartsWith(TEXT("+"))))
+					{
+						Value.InsertAt(1, FString::ChrN(Padding, TEXT('0')));
+					}
+					else Value = FString::ChrN(Padding, bZeroPad && Conversion != TEXT('s') ? TEXT('0') : TEXT(' ')) + Value;
+				}
+				Result += Value;
+			}
+
+			return Result;
+		}
+
+		bool DecodeArgs(const uint8* Payload, const uint32 PayloadSize, TArray<FDecodedArg>& OutArgs)
+		{
+			OutArgs.Reset();
+			uint32 Offset = 0;
+			auto Read = [&](void* Dest, const uint32 Size)
+			{
+				if (Offset + Size > PayloadSize) return false;
+				FMemory::Memcpy(Dest, Payload + Offset, Size);
+				Offset += Size;
+				return true;
+			};
+
+			while (Offset < PayloadSize)
+			{
+				FDecodedArg& Arg = OutArgs.AddDefaulted_GetRef();
+				uint8 Type = 0;
+				if (!Read(&Type, 1)) return false;
+				Arg.Type = static_cast<EStructuredArgType>(Type);
+
+				bool bRead = true;
+				switch (Arg.Type)
+				{
+				case EStructuredArgType::Int32:
+					{
+						int32 Value = 0;
+						bRead = Read(&Value, sizeof(Value));
+						Arg.Signed = Value;
+						Arg.Double = Value;
+						break;
+					}
+				case EStructuredArgType::UInt32:
+					{
+						uint32 Value = 0;
+						bRead = Read(&Value, sizeof(Value));
+						Arg.Unsigned = Value;
+						Arg.Double = Value;
+						break;
+					}
+				case EStructuredArgType::Int64:
+					bRead = Read(&Arg.Signed, sizeof(Arg.Signed));
+					Arg.Double = static_cast<double>(Arg.Signed);
+					break;
+				case EStructuredArgType::UInt64:
+				case EStructuredArgType::Pointer:
+					bRead = Read(&Arg.Unsigned, sizeof(Arg.Unsigned));
+					Arg.Double = static_cast<double>(Arg.Unsigned);
+					break;
+				case EStructuredArgType::Double:
+					bRead = Read(&Arg.Double, sizeof(Arg.Double));
+					Arg.Signed = static_cast<int64>(Arg.Double);
+					break;
+				case EStructuredArgType::String:
+					{
+						uint32 Length = 0;
+						bRead = Read(&Length, sizeof(Length)) && Offset + Length <= PayloadSize;
+						if (bRead)
+						{
+							Arg.String = FString(Length, reinterpret_cast<const UTF8CHAR*>(Payload + Offset));
+							Offset += Length;
+						}
+						break;
+					}
+				default:
+					return false;
+				}
+
+				if (!bRead) return false;
+			}
+			return true;
+		}
+
+		FAutoConsoleCommand CmdStartStructuredLog(
+			TEXT("Logger.StructuredLog.Start"),
+			TEXT("Starts capturing ULOG_*/SLOG lines into a binary .slog file. Usage: Logger.StructuredLog.Start [File]"),
+			FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+			{
+				FStructuredLogSink::Start(Args.Num() > 0 ? Args[0] : FString());
+			}));
+
+		FAutoConsoleCommand CmdStopStructuredLog(
+			TEXT("Logger.StructuredLog.Stop"),
+			TEXT("Stops the structured log capture and closes its file."),
+			FConsoleCommandDelegate::CreateStatic(&FStructuredLogSink::Stop));
+
+		FAutoConsoleCommand CmdFlushStructuredLog(
+			TEXT("Logger.StructuredLog.Flush"),
+			TEXT("Writes buffered structured log events to the capture file."),
+			FConsoleCommandDelegate::CreateStatic(&FStructuredLogSink::Flush));
+	}
+
+	FStructuredLogSite::FStructuredLogSite(const FName InCategory, const ELogVerbosity::Type InVerbosity,
+	                                       const TCHAR* InFormat, const TCHAR* InCallSite, const ANSICHAR* InFile,
+	                                       const int32 InLine)
+		: Category(InCategory), Verbosity(InVerbosity), Format(InFormat), CallSite(InCallSite), File(InFile),
+		  Line(InLine)
+	{
+		Id = FStructuredLogSink::RegisterSite(*this);
+	}
+
+	bool FStructuredLogSink::Start(const FString& Filename)
+	{
+		FScopeLock Lock(&SessionLock);
+		if (Writer) return true;
+
+		const FString FinalFilename = !Filename.IsEmpty()
+			                              ? Filename
+			                              : FPaths::ProjectLogDir() / FString::Printf(
+				                              TEXT("%s-%s.slog"), FApp::GetProjectName(), *FDateTime::Now().ToString());
+
+		FArchive* File = IFileManager::Get().CreateFileWriter(*FinalFilename, FILEWRITE_AllowRead);
+		if (!File)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Structured log: could not open %s"), *FinalFilename);
+			return false;
+		}
+
+		Writer = new FStructuredLogWriter(File, FinalFilename);
+		WriterThread = FRunnableThread::Create(Writer, TEXT("StructuredLogWriter"), 0, TPri_BelowNormal);
+		bCapturing.store(true, std::memory_order_release);
+
+		UE_LOG(LogTemp, Log, TEXT("Structured log: capturing into %s"), *FinalFilename);
+		return true;
+	}
+
+	void FStructuredLogSink::Stop()
+	{
+		FScopeLock Lock(&SessionLock);
+		if (!Writer) return;
+
+		bCapturing.store(false, std::memory_order_release);
+
+		// Kill(true) runs the writer's final flush before joining
+		WriterThread->Kill(true);
+		delete WriterThread;
+		WriterThread = nullptr;
+
+		UE_LOG(LogTemp, Log, TEXT("Structured log: closed %s"), *Writer->GetFilename());
+		delete Writer;
+		Writer = nullptr;
+	}
+
+	void FStructuredLogSink::Flush()
+	{
+		FScopeLock Lock(&SessionLock);
+		if (Writer) Writer->Wake();
+	}
+
+	FString FStructuredLogSink::GetFilename()
+	{
+		FScopeLock Lock(&SessionLock);
+		return Writer ? Writer->GetFilename() : FString();
+	}
+
+	uint32 FStructuredLogSink::RegisterSite(const FStructuredLogSite& Site)
+	{
+		FScopeLock Lock(&RegistryLock);
+		return static_cast<uint32>(Sites.Add(&Site));
+	}
+
+	void FStructuredLogSink::Write(const uint32 SiteId, const uint8* Payload, const uint32 PayloadSize)
+	{
+		GetThreadBuffer().Write(SiteId, Payload, PayloadSize);
+	}
+
+	bool DecodeStructuredLog(const FString& Filename, TFunctionRef<void(const FStructuredLogEntry&)> Visitor,
+	                         FString& OutError)
+	{
+		TUniquePtr<FArchive> File(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_AllowWrite));
+		if (!File)
+		{
+			OutError = FString::Printf(TEXT("Could not open %s"), *Filename);
+			return false;
+		}
+
+		uint32 Magic = 0;
+		uint32 Version = 0;
+		uint64 StartCycles = 0;
+		int64 StartTicks = 0;
+		double SecondsPerCycle = 0.0;
+		*File << Magic << Version << StartCycles << StartTicks << SecondsPerCycle;
+		if (File->IsError() || Magic != FileMagic || Version != FileVersion)
+		{
+			OutError = FString::Printf(TEXT("%s is not a version %u structured log"), *Filename, FileVersion);
+			return false;
+		}
+
+		const auto ToTime = [&](const uint64 Cycles)
+		{
+			return FDateTime(StartTicks) + FTimespan::FromSeconds((static_cast<int64>(Cycles - StartCycles)) * SecondsPerCycle);
+		};
+
+		TMap<uint32, FStructuredLogEntry> SiteEntries;
+		TMap<uint32, FString> ThreadNames;
+		TArray<uint8> Payload;
+		TArray<FDecodedArg> Args;
+
+		// A capture cut short (crash, kill) ends with a partial record: stop there and keep what was decoded
+		while (File->Tell() < File->TotalSize() && !File->IsError())
+		{
+			uint8 Type = 0;
+			*File << Type;
+
+			switch (static_cast<ERecordType>(Type))
+			{
+			case ERecordType::Site:
+				{
+					uint32 Id = 0;
+					uint8 Verbosity = 0;
+					int32 Line = 0;
+					*File << Id << Verbosity << Line;
+
+					FStructuredLogEntry& Site = SiteEntries.FindOrAdd(Id);
+					Site.Verbosity = static_cast<ELogVerbosity::Type>(Verbosity);
+					Site.Line = Line;
+					Site.Category = FName(ReadString(*File));
+					Site.Format = ReadString(*File);
+					Site.CallSite = ReadString(*File);
+					Site.File = ReadString(*File);
+					break;
+				}
+			case ERecordType::Thread:
+				{
+					uint32 ThreadId = 0;
+					*File << ThreadId;
+					ThreadNames.Add(ThreadId, ReadString(*File));
+					break;
+				}
+			case ERecordType::Event:
+				{
+					uint32 ThreadId = 0;
+					uint32 SiteId = 0;
+					uint64 Cycles = 0;
+					uint32 PayloadSize = 0;
+					*File << ThreadId << SiteId << Cycles << PayloadSize;
+					if (File->IsError() || PayloadSize > File->TotalSize() - File->Tell()) return true;
+
+					Payload.SetNumUninitialized(PayloadSize);
+					File->Serialize(Payload.GetData(), PayloadSize);
+
+					const FStructuredLogEntry* Site = SiteEntries.Find(SiteId);
+					if (!Site)
+					{
+						OutError = FString::Printf(TEXT("Event refers to unknown site %u"), SiteId);
+						return false;
+					}
+
+					FStructuredLogEntry Entry = *Site;
+					Entry.Time = ToTime(Cycles);
+					Entry.ThreadId = ThreadId;
+					Entry.ThreadName = ThreadNames.FindRef(ThreadId);
+					Entry.Message = DecodeArgs(Payload.GetData(), PayloadSize, Args)
+						                ? FormatDecodedMessage(Entry.Format, Args)
+						                : FString::Printf(TEXT("<corrupt arguments> %s"), *Entry.Format);
+					Visitor(Entry);
+					break;
+				}
+			case ERecordType::Dropped:
+				{
+					uint32 ThreadId = 0;
+					uint64 Cycles = 0;
+					uint32 NumDropped = 0;
+					*File << ThreadId << Cycles << NumDropped;
+
+					FStructuredLogEntry Entry;
+					Entry.Time = ToTime(Cycles);
+					Entry.ThreadId = ThreadId;
+					Entry.ThreadName = ThreadNames.FindRef(ThreadId);
+					Entry.Category = TEXT("StructuredLog");
+					Entry.Verbosity = ELogVerbosity::Warning;
+					Entry.Message = FString::Printf(TEXT("%u events dropped, ring buffer full"), NumDropped);
+					Visitor(Entry);
+					break;
+				}
+			default:
+				OutError = FString::Printf(TEXT("Unknown record type %u at offset %lld"), Type, File->Tell() - 1);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	namespace Private
+	{
+		void AppendString(FStructuredPayload& Payload, const TCHAR* Value)
+		{
+			const FTCHARToUTF8 Converted(Value ? Value : TEXT(""));
+			const uint32 Length = Converted.Length();
+			AppendRaw(Payload, Length);
+			Payload.Append(reinterpret_cast<const uint8*>(Converted.Get()), Length);
+		}
+
+		void AppendString(FStructuredPayload& Payload, const ANSICHAR* Value)
+		{
+			const uint32 Length = Value ? FCStringAnsi::Strlen(Value) : 0;
+			AppendRaw(Payload, Length);
+			Payload.Append(reinterpret_cast<const uint8*>(Value), Length);
+		}
+	}
+}
@@ -2,17 +2,28 @@
 
 #include "LoggerModule.h"
 
+#include "Log/StructuredLog.h"
+
 #define LOCTEXT_NAMESPACE "FLoggerModule"
 
 void FLoggerModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+
+	// -StructuredLog or -StructuredLog=<File> captures ULOG_*/SLOG lines from startup
+	FString StructuredLogFile;
+	if (FParse::Value(FCommandLine::Get(), TEXT("StructuredLog="), StructuredLogFile))
+	{
+		UE::Logger::FStructuredLogSink::Start(StructuredLogFile);
+	}
+	else if (FParse::Param(FCommandLine::Get(), TEXT("StructuredLog"))) { UE::Logger::FStructuredLogSink::Start(); }
 }
 
 void FLoggerModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	UE::Logger::FStructuredLogSink::Stop();
 }
 
 #undef LOCTEXT_NAMESPACE
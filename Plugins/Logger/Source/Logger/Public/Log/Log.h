@@ -2,47 +2,66 @@
 
 #include "GameFramework/Actor.h"
 #include "Logging/LogMacros.h"
+#include "Log/StructuredLog.h"
 
-LOGGER_API DECLARE_LOG_CATEGORY_EXTERN(LogGAS, Log, All);
+/*
+ * Compile-time verbosity of the Logger categories. Lines above it are stripped by UE_LOG at compile time,
+ * e.g. add LOGGER_COMPILE_TIME_VERBOSITY=Warning to a target's definitions to drop Log/Verbose lines entirely.
+ */
+#ifndef LOGGER_COMPILE_TIME_VERBOSITY
+#define LOGGER_COMPILE_TIME_VERBOSITY All
+#endif
 
-LOGGER_API DECLARE_LOG_CATEGORY_EXTERN(LogCORE, Log, All);
+LOGGER_API DECLARE_LOG_CATEGORY_EXTERN(LogGAS, Log, LOGGER_COMPILE_TIME_VERBOSITY);
 
-LOGGER_API DECLARE_LOG_CATEGORY_EXTERN(LogExperience, Log, All);
+LOGGER_API DECLARE_LOG_CATEGORY_EXTERN(LogCORE, Log, LOGGER_COMPILE_TIME_VERBOSITY);
+
+LOGGER_API DECLARE_LOG_CATEGORY_EXTERN(LogExperience, Log, LOGGER_COMPILE_TIME_VERBOSITY);
 
 //CUSTOMCORE_API DECLARE_LOG_CATEGORY_EXTERN(LogGASAbilitySystem, Log, All);
 //CUSTOMCORE_API DECLARE_LOG_CATEGORY_EXTERN(LogGASTeams, Log, All);
 
-#ifdef _MSC_VER
-#define __CLASS_FUNCTION__ __FUNCTION__
+#if defined(_MSC_VER) && !defined(__clang__)
+#define LOGGER_FUNCTION_SIGNATURE __FUNCTION__
+#else
+#define LOGGER_FUNCTION_SIGNATURE __PRETTY_FUNCTION__
 #endif
 
-#ifdef __GNUG__
-#include <cxxabi.h>
-#include <execinfo.h>
-char* class_func(const char* c, const char* f)
+namespace UE::Logger
 {
-	int status;
-	static char buff[100];
-	char* demangled = abi::__cxa_demangle(c, NULL, NULL, &status);
-	snprintf(buff, sizeof(buff), "%s::%s", demangled, f);
-	free(demangled);
-	return buff;
+	/* Reduces a compiler function signature ("void UFoo::Bar(int32) const") to "UFoo::Bar". */
+	LOGGER_API FString MakeCallSiteName(const ANSICHAR* Signature);
 }
-#define __CLASS_FUNCTION__ class_func(typeid(*this).name(), __func__)
-#endif
 
- LOGGER_API FString GetClientServerContext(UObject* ContextObject);
+/*
+ * ClassName::FunctionName of the call site as a const TCHAR*. Resolved once per call site into a function-local
+ * static (thread-safe initialization) and usable from static functions and lambdas, as it does not need `this`.
+ */
+#define LOGGER_CALL_SITE_NAME \
+	([](const ANSICHAR* Signature) -> const TCHAR* \
+	{ \
+		static const FString CallSiteName = UE::Logger::MakeCallSiteName(Signature); \
+		return *CallSiteName; \
+	}(LOGGER_FUNCTION_SIGNATURE))
+
+/* Kept for callers that still expect the old name. */
+#define __CLASS_FUNCTION__ LOGGER_CALL_SITE_NAME
+
+LOGGER_API FString GetClientServerContext(UObject* ContextObject);
+
+/* Same as GetClientServerContext, without allocating. */
+LOGGER_API const TCHAR* GetClientServerContextName(const UObject* ContextObject);
 
 void PrintCallStack();
 
 void ConsoleLog(const FString& Message);
 
 /* ClassName::FunctionName where this is called. */
-#define CURRENT_CLASS_FUNCTION (FString(__CLASS_FUNCTION__))
+#define CURRENT_CLASS_FUNCTION (FString(LOGGER_CALL_SITE_NAME))
 /* Class Name where this is called. */
-#define CURRENT_CLASS (FString(__CLASS_FUNCTION__).Left(FString(__CLASS_FUNCTION__).Find(TEXT(":"))) )
+#define CURRENT_CLASS (CURRENT_CLASS_FUNCTION.Left(CURRENT_CLASS_FUNCTION.Find(TEXT(":"))))
 /* Function Name where this is called. */
-#define CURRENT_FUNCTION (FString(__CLASS_FUNCTION__).Right(FString(__CLASS_FUNCTION__).Len() - FString(__CLASS_FUNCTION__).Find(TEXT("::")) - 2 ))
+#define CURRENT_FUNCTION (CURRENT_CLASS_FUNCTION.RightChop(CURRENT_CLASS_FUNCTION.Find(TEXT("::"), ESearchCase::CaseSensitive, ESearchDir::FromEnd) + 2))
 /* Line Number where this is called. */
 #define CURRENT_LINE  (FString::FromInt(__LINE__))
 /* Class Name and Line Number where this is called. */
@@ -50,9 +69,9 @@ void ConsoleLog(const FString& Message);
 /* Class Name and Function Name and Line Number where this is called. */
 #define CURRENT_CLASS_FUNCTION_LINE (CURRENT_CLASS_FUNCTION + ":" + CURRENT_LINE )
 /* Function Signature where this is called. */
-#define CURRENT_FUNCTIONSIG (FString(__FUNCSIG__))
+#define CURRENT_FUNCTIONSIG (FString(ANSI_TO_TCHAR(LOGGER_FUNCTION_SIGNATURE)))
 
-#define CLIENT_SERVER_CONTEXT     GetClientServerContext(this)
+#define CLIENT_SERVER_CONTEXT     GetClientServerContextName(this)
 #define OBJECT_OWNER  GetNameSafe(GetOwner())
 #define CLASS_OWNER   GetNameSafe(this)
 
@@ -60,8 +79,11 @@ void ConsoleLog(const FString& Message);
 
 /*
  * UE_LOG macros
+ *
+ * The prefix is folded into the format literal so every line is formatted exactly once, and all arguments are
+ * evaluated inside UE_LOG's verbosity check: a suppressed or compiled-out line costs nothing beyond that check.
  */
-#define LOG_SIMPLE2(CategoryName,Verbosity, Message) UE_LOG(CategoryName, Verbosity,TEXT("[%s] [%s -> %s] %s : %s"), *CLIENT_SERVER_CONTEXT, *OBJECT_OWNER, *CLASS_OWNER, *CURRENT_CLASS_FUNCTION_LINE, *FString(Message))
+#define LOG_SIMPLE2(CategoryName,Verbosity, Message) UE_LOG(CategoryName, Verbosity, TEXT("[%s] [%s -> %s] %s:%d : %s"), CLIENT_SERVER_CONTEXT, *OBJECT_OWNER, *CLASS_OWNER, LOGGER_CALL_SITE_NAME, __LINE__, *FString(Message))
 
 #define LOG_GLOBAL_SIMPLE(Condition,CategoryName,Verbosity, Message)  \
 	{ \
@@ -71,15 +93,23 @@ void ConsoleLog(const FString& Message);
 	}
 
 #if WITH_EDITOR
-/* Log macro. Style: ClassName::FunctionName (Line) Message. */
-#define LOG(CategoryName,Verbosity, FormatString , ...) UE_LOG(CategoryName, Verbosity, TEXT("[%s] [%s -> %s] %s : %s"), *CLIENT_SERVER_CONTEXT, *OBJECT_OWNER, *CLASS_OWNER, *CURRENT_CLASS_FUNCTION_LINE, *FString::Printf(TEXT(FormatString), ##__VA_ARGS__ ) )
+/* Log macro. Style: [Context] [Owner -> Object] ClassName::FunctionName:Line : Message. */
+#define LOG(CategoryName,Verbosity, FormatString , ...) UE_LOG(CategoryName, Verbosity, TEXT("[%s] [%s -> %s] %s:%d : ") TEXT(FormatString), CLIENT_SERVER_CONTEXT, *OBJECT_OWNER, *CLASS_OWNER, LOGGER_CALL_SITE_NAME, __LINE__, ##__VA_ARGS__ )
 #else
 	#define LOG(CategoryName, Verbosity, FormatString, ...) {}
 #endif
-/* Log warning macro. Style: ClassName::FunctionName (Line) Message. */
-
 
-#define UELOG(CategoryName,Verbosity, FormatString , ...) UE_LOG(CategoryName, Verbosity, TEXT("%s : %s"),  *CURRENT_CLASS_FUNCTION_LINE, *FString::Printf(TEXT(FormatString), ##__VA_ARGS__ ) )
+/*
+ * Log macro without object context, usable anywhere. Style: ClassName::FunctionName:Line : Message.
+ * While a structured capture runs (see StructuredLog.h) non-fatal lines only record their arguments there.
+ */
+#define UELOG(CategoryName,Verbosity, FormatString , ...) \
+	{ \
+		if (ELogVerbosity::Verbosity != ELogVerbosity::Fatal && UE::Logger::FStructuredLogSink::IsCapturing()) \
+			SLOG(CategoryName, Verbosity, FormatString, ##__VA_ARGS__) \
+		else \
+			UE_LOG(CategoryName, Verbosity, TEXT("%s:%d : ") TEXT(FormatString), LOGGER_CALL_SITE_NAME, __LINE__, ##__VA_ARGS__ ); \
+	}
 #define ULOG_INFO(CategoryName, FormatString , ...) UELOG(CategoryName, Log, FormatString,  ##__VA_ARGS__ )
 #define ULOG_WARNING(CategoryName, FormatString , ...) UELOG(CategoryName, Warning, FormatString,  ##__VA_ARGS__ )
 #define ULOG_ERROR(CategoryName, FormatString , ...) UELOG(CategoryName, Error, FormatString, ##__VA_ARGS__ )
@@ -95,9 +125,9 @@ void ConsoleLog(const FString& Message);
  * Screen Messages macros
  */
 #if WITH_EDITOR
-#define LOG_SCREEN(Color, FormatString , ...) if(GEngine) GEngine->AddOnScreenDebugMessage(-1, 10.0f, Color, *(CURRENT_CLASS_FUNCTION_LINE + ": [ INFO ] " + (FString::Printf(TEXT(FormatString), ##__VA_ARGS__ ))))
+#define LOG_SCREEN(Color, FormatString , ...) if(GEngine) GEngine->AddOnScreenDebugMessage(-1, 10.0f, Color, FString::Printf(TEXT("%s:%d: [ INFO ] ") TEXT(FormatString), LOGGER_CALL_SITE_NAME, __LINE__, ##__VA_ARGS__ ))
 #else
-	#define LOG_SCREEN(Color, Message) {}
+	#define LOG_SCREEN(Color, FormatString, ...) {}
 #endif
 
 #define LOG_SCREEN_INFO(FormatString , ...) LOG_SCREEN(FColor::Cyan, FormatString , ##__VA_ARGS__)
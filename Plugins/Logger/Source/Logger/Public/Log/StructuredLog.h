@@ -0,0 +1,172 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+#include <atomic>
+#include <type_traits>
+
+/*
+ * Structured (binary) logging.
+ *
+ * Each SLOG call site registers a static descriptor (category, verbosity, format, call site) the first time it fires.
+ * Every event then only copies its raw arguments into a lock-free ring buffer owned by the calling thread; a background
+ * thread drains the buffers into a compact .slog file which the StructuredLogDecode commandlet turns back into text
+ * or JSON. Nothing is formatted on the logging thread.
+ *
+ * Capture is off by default: start it with -StructuredLog[=File] or Logger.StructuredLog.Start [File].
+ * While it runs, ULOG_* lines (except Fatal) are routed here instead of the text log.
+ */
+namespace UE::Logger
+{
+	enum class EStructuredArgType : uint8
+	{
+		Int32,
+		UInt32,
+		Int64,
+		UInt64,
+		Double,
+		String,
+		Pointer
+	};
+
+	/* Static description of a structured log call site. Must outlive the capture (SLOG makes it function-local static). */
+	struct LOGGER_API FStructuredLogSite
+	{
+		FStructuredLogSite(const FName InCategory, const ELogVerbosity::Type InVerbosity, const TCHAR* InFormat,
+		                   const TCHAR* InCallSite, const ANSICHAR* InFile, const int32 InLine);
+
+		FName Category;
+		ELogVerbosity::Type Verbosity;
+		const TCHAR* Format;
+		const TCHAR* CallSite;
+		const ANSICHAR* File;
+		int32 Line;
+		uint32 Id;
+	};
+
+	class LOGGER_API FStructuredLogSink
+	{
+	public:
+		static bool IsCapturing() { return bCapturing.load(std::memory_order_relaxed); }
+
+		/* Starts capturing into Filename (defaults to a timestamped .slog in the project log dir). */
+		static bool Start(const FString& Filename = FString());
+		static void Stop();
+		/* Wakes the writer thread so buffered events reach the file. */
+		static void Flush();
+		static FString GetFilename();
+
+		/* Registers a call site and returns its id. Called once per site from FStructuredLogSite. */
+		static uint32 RegisterSite(const FStructuredLogSite& Site);
+
+		/* Copies an encoded event into the calling thread's ring buffer. Drops it (and counts the drop) when full. */
+		static void Write(uint32 SiteId, const uint8* Payload, uint32 PayloadSize);
+
+	private:
+		static std::atomic<bool> bCapturing;
+	};
+
+	/* One decoded event of a .slog file. */
+	struct FStructuredLogEntry
+	{
+		FDateTime Time;
+		uint32 ThreadId = 0;
+		FString ThreadName;
+		FName Category;
+		ELogVerbosity::Type Verbosity = ELogVerbosity::Log;
+		FString CallSite;
+		int32 Line = 0;
+		FString File;
+		FString Format;
+		FString Message;
+	};
+
+	/* Reads a .slog file and calls Visitor for every event in write order. */
+	LOGGER_API bool DecodeStructuredLog(const FString& Filename, TFunctionRef<void(const FStructuredLogEntry&)> Visitor,
+	                                    FString& OutError);
+
+	namespace Private
+	{
+		using FStructuredPayload = TArray<uint8, TInlineAllocator<256>>;
+
+		template <typename T>
+		void AppendRaw(FStructuredPayload& Payload, const T& Value)
+		{
+			Payload.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+		}
+
+		LOGGER_API void AppendString(FStructuredPayload& Payload, const TCHAR* Value);
+		LOGGER_API void AppendString(FStructuredPayload& Payload, const ANSICHAR* Value);
+
+		template <typename T>
+		void EncodeArg(FStructuredPayload& Payload, const T& Value)
+		{
+			using FArg = std::decay_t<T>;
+
+			if constexpr (std::is_same_v<FArg, TCHAR*> || std::is_same_v<FArg, const TCHAR*>
+				|| std::is_same_v<FArg, ANSICHAR*> || std::is_same_v<FArg, const ANSICHAR*>)
+			{
+				Payload.Add(static_cast<uint8>(EStructuredArgType::String));
+				AppendString(Payload, Value);
+			}
+			else if constexpr (std::is_pointer_v<FArg>)
+			{
+				Payload.Add(static_cast<uint8>(EStructuredArgType::Pointer));
+				AppendRaw(Payload, static_cast<uint64>(reinterpret_cast<UPTRINT>(Value)));
+			}
+			else if constexpr (std::is_enum_v<FArg>) { EncodeArg(Payload, static_cast<std::underlying_type_t<FArg>>(Value)); }
+			else if constexpr (std::is_floating_point_v<FArg>)
+			{
+				Payload.Add(static_cast<uint8>(EStructuredArgType::Double));
+				AppendRaw(Payload, static_cast<double>(Value));
+			}
+			else if constexpr (std::is_integral_v<FArg> && sizeof(FArg) <= sizeof(int32))
+			{
+				if constexpr (std::is_signed_v<FArg>)
+				{
+					Payload.Add(static_cast<uint8>(EStructuredArgType::Int32));
+					AppendRaw(Payload, static_cast<int32>(Value));
+				}
+				else
+				{
+					Payload.Add(static_cast<uint8>(EStructuredArgType::UInt32));
+					AppendRaw(Payload, static_cast<uint32>(Value));
+				}
+			}
+			else if constexpr (std::is_integral_v<FArg>)
+			{
+				if constexpr (std::is_signed_v<FArg>)
+				{
+					Payload.Add(static_cast<uint8>(EStructuredArgType::Int64));
+					AppendRaw(Payload, static_cast<int64>(Value));
+				}
+				else
+				{
+					Payload.Add(static_cast<uint8>(EStructuredArgType::UInt64));
+					AppendRaw(Payload, static_cast<uint64>(Value));
+				}
+			}
+			else { static_assert(sizeof(FArg) == 0, "Unsupported structured log argument, pass printf-compatible values"); }
+		}
+
+		template <typename... ArgTypes>
+		void WriteStructuredLog(const FStructuredLogSite& Site, const ArgTypes&... Args)
+		{
+			FStructuredPayload Payload;
+			(EncodeArg(Payload, Args), ...);
+			FStructuredLogSink::Write(Site.Id, Payload.GetData(), Payload.Num());
+		}
+	}
+}
+
+/* Structured log macro. Same arguments as UE_LOG; the format is stored once per call site, only arguments per event. */
+#define SLOG(CategoryName, Verbosity, FormatString, ...) \
+	{ \
+		if (UE_LOG_ACTIVE(CategoryName, Verbosity) && UE::Logger::FStructuredLogSink::IsCapturing()) \
+		{ \
+			static const UE::Logger::FStructuredLogSite StructuredLogSite(CategoryName.GetCategoryName(), ELogVerbosity::Verbosity, \
+				TEXT(FormatString), LOGGER_CALL_SITE_NAME, __FILE__, __LINE__); \
+			UE::Logger::Private::WriteStructuredLog(StructuredLogSite, ##__VA_ARGS__); \
+		} \
+	}
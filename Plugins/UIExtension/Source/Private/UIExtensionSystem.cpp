@@ -34,24 +34,36 @@ void FUIExtensionHandle::Unregister()
 
 bool FUIExtensionPoint::DoesExtensionPassContract(const FUIExtension* Extension) const
 {
-	if (UObject* DataPtr = Extension->Data)
+	// Make sure the contexts match.
+	if (DoesExtensionMatchContext(Extension))
 	{
-		const bool bMatchesContext = 
-			(ContextObject.IsExplicitlyNull() && Extension->ContextObject.IsExplicitlyNull()) ||
-			ContextObject == Extension->ContextObject;
+		return DoesDataClassPassContract(GetExtensionDataClass(Extension), AllowedDataClasses);
+	}
+
+	return false;
+}
 
-		// Make sure the contexts match.
-		if (bMatchesContext)
+bool FUIExtensionPoint::DoesExtensionMatchContext(const FUIExtension* Extension) const
+{
+	return Extension->Data &&
+		((ContextObject.IsExplicitlyNull() && Extension->ContextObject.IsExplicitlyNull()) ||
+		ContextObject == Extension->ContextObject);
+}
+
+const UClass* FUIExtensionPoint::GetExtensionDataClass(const FUIExtension* Extension)
+{
+	// The data can either be the literal class of the data type, or a instance of the class type.
+	const UObject* DataPtr = Extension->Data;
+	return DataPtr->IsA(UClass::StaticClass()) ? Cast<UClass>(DataPtr) : DataPtr->GetClass();
+}
+
+bool FUIExtensionPoint::DoesDataClassPassContract(const UClass* DataClass, const TArray<TObjectPtr<UClass>>& AllowedDataClasses)
+{
+	for (const UClass* AllowedDataClass : AllowedDataClasses)
+	{
+		if (DataClass->IsChildOf(AllowedDataClass) || DataClass->ImplementsInterface(AllowedDataClass))
 		{
-			// The data can either be the literal class of the data type, or a instance of the class type.
-			const UClass* DataClass = DataPtr->IsA(UClass::StaticClass()) ? Cast<UClass>(DataPtr) : DataPtr->GetClass();
-			for (const UClass* AllowedDataClass : AllowedDataClasses)
-			{
-				if (DataClass->IsChildOf(AllowedDataClass) || DataClass->ImplementsInterface(AllowedDataClass))
-				{
-					return true;
-				}
-			}
+			return true;
 		}
 	}
 
@@ -87,13 +99,135 @@ void UUIExtensionSubsystem::AddReferencedObjects(UObject* InThis, FReferenceColl
 void UUIExtensionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.AddUObject(this, &ThisClass::HandleObjectsReinstanced);
+#endif
 }
 
 void UUIExtensionSubsystem::Deinitialize()
 {
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectsReinstanced.RemoveAll(this);
+#endif
+
+	ExtensionPointsByExtensionTag.Reset();
+	TagChains.Reset();
+	Contracts.Reset();
+	ContractResults.Reset();
+
 	Super::Deinitialize();
 }
 
+const TArray<FGameplayTag>& UUIExtensionSubsystem::GetTagChain(const FGameplayTag& Tag)
+{
+	if (const TArray<FGameplayTag>* Chain = TagChains.Find(Tag))
+	{
+		return *Chain;
+	}
+
+	TArray<FGameplayTag> Chain;
+	for (FGameplayTag ParentTag = Tag; ParentTag.IsValid(); ParentTag = ParentTag.RequestDirectParent())
+	{
+		Chain.Add(ParentTag);
+	}
+
+	return TagChains.Add(Tag, MoveTemp(Chain));
+}
+
+bool UUIExtensionSubsystem::DoesExtensionPointMatchTag(const FUIExtensionPoint& ExtensionPoint, const FGameplayTag& ExtensionTag, const TArray<FGameplayTag>& ExtensionTagChain)
+{
+	// Exact points only hear about their own tag, partial ones about every tag below them too.
+	return ExtensionPoint.ExtensionPointTag == ExtensionTag ||
+		(ExtensionPoint.ExtensionPointTagMatchType == EUIExtensionPointMatch::PartialMatch && ExtensionTagChain.Contains(ExtensionPoint.ExtensionPointTag));
+}
+
+const UUIExtensionSubsystem::FExtensionPointList& UUIExtensionSubsystem::FindOrAddExtensionPointsForTag(const FGameplayTag& ExtensionTag)
+{
+	if (const FExtensionPointList* ListPtr = ExtensionPointsByExtensionTag.Find(ExtensionTag))
+	{
+		return *ListPtr;
+	}
+
+	FExtensionPointList MatchingPoints;
+	const TArray<FGameplayTag>& ExtensionTagChain = GetTagChain(ExtensionTag);
+	for (const FGameplayTag& Tag : ExtensionTagChain)
+	{
+		if (const FExtensionPointList* ListPtr = ExtensionPointMap.Find(Tag))
+		{
+			for (const TSharedPtr<FUIExtensionPoint>& ExtensionPoint : *ListPtr)
+			{
+				if (DoesExtensionPointMatchTag(*ExtensionPoint, ExtensionTag, ExtensionTagChain))
+				{
+					MatchingPoints.Add(ExtensionPoint);
+				}
+			}
+		}
+	}
+
+	return ExtensionPointsByExtensionTag.Add(ExtensionTag, MoveTemp(MatchingPoints));
+}
+
+void UUIExtensionSubsystem::InvalidateExtensionPointIndex(const FUIExtensionPoint& ExtensionPoint)
+{
+	// Rebuilt on the next lookup, so points keep being notified exact tag first, then parent tags, in registration order.
+	for (auto MapIt = ExtensionPointsByExtensionTag.CreateIterator(); MapIt; ++MapIt)
+	{
+		if (DoesExtensionPointMatchTag(ExtensionPoint, MapIt.Key(), GetTagChain(MapIt.Key())))
+		{
+			MapIt.RemoveCurrent();
+		}
+	}
+}
+
+bool UUIExtensionSubsystem::DoesExtensionPassContract(const FUIExtensionPoint& ExtensionPoint, const FUIExtension& Extension)
+{
+	if (!ExtensionPoint.DoesExtensionMatchContext(&Extension))
+	{
+		return false;
+	}
+
+	const UClass* DataClass = FUIExtensionPoint::GetExtensionDataClass(&Extension);
+	const TPair<TObjectKey<UClass>, int32> Key(DataClass, ExtensionPoint.ContractIndex);
+	if (const bool* Result = ContractResults.Find(Key))
+	{
+		return *Result;
+	}
+
+	return ContractResults.Add(Key, FUIExtensionPoint::DoesDataClassPassContract(DataClass, ExtensionPoint.AllowedDataClasses));
+}
+
+int32 UUIExtensionSubsystem::FindOrAddContract(const TArray<TObjectPtr<UClass>>& AllowedDataClasses)
+{
+	TArray<TObjectKey<UClass>> Contract;
+	Contract.Reserve(AllowedDataClasses.Num());
+	for (const UClass* AllowedDataClass : AllowedDataClasses)
+	{
+		Contract.Add(AllowedDataClass);
+	}
+
+	// There's only ever a handful of distinct contracts (widgets, a few data types).
+	const int32 ContractIndex = Contracts.IndexOfByKey(Contract);
+	return ContractIndex != INDEX_NONE ? ContractIndex : Contracts.Add(MoveTemp(Contract));
+}
+
+#if WITH_EDITOR
+void UUIExtensionSubsystem::HandleObjectsReinstanced(const FCoreUObjectDelegates::FReplacementObjectMap& OldToNewInstanceMap)
+{
+	// A recompiled Blueprint class is a new class object, so contracts and the results cached against the old one are rebuilt.
+	Contracts.Reset();
+	ContractResults.Reset();
+
+	for (auto MapIt = ExtensionPointMap.CreateIterator(); MapIt; ++MapIt)
+	{
+		for (const TSharedPtr<FUIExtensionPoint>& ExtensionPoint : MapIt.Value())
+		{
+			ExtensionPoint->ContractIndex = FindOrAddContract(ExtensionPoint->AllowedDataClasses);
+		}
+	}
+}
+#endif
+
 FUIExtensionPointHandle UUIExtensionSubsystem::RegisterExtensionPoint(const FGameplayTag& ExtensionPointTag, EUIExtensionPointMatch ExtensionPointTagMatchType, const TArray<UClass*>& AllowedDataClasses, FExtendExtensionPointDelegate ExtensionCallback)
 {
 	return RegisterExtensionPointForContext(ExtensionPointTag, nullptr, ExtensionPointTagMatchType, AllowedDataClasses, ExtensionCallback);
@@ -127,9 +261,12 @@ FUIExtensionPointHandle UUIExtensionSubsystem::RegisterExtensionPointForContext(
 	Entry->ExtensionPointTagMatchType = ExtensionPointTagMatchType;
 	Entry->AllowedDataClasses = AllowedDataClasses;
 	Entry->Callback = MoveTemp(ExtensionCallback);
+	Entry->ContractIndex = FindOrAddContract(Entry->AllowedDataClasses);
 
 	UE_LOG(LogUIExtension, Verbose, TEXT("Extension Point [%s] Registered"), *ExtensionPointTag.ToString());
 
+	InvalidateExtensionPointIndex(*Entry);
+
 	NotifyExtensionPointOfExtensions(Entry);
 
 	return FUIExtensionPointHandle(this, Entry);
@@ -183,16 +320,18 @@ FUIExtensionHandle UUIExtensionSubsystem::RegisterExtensionAsData(const FGamepla
 
 void UUIExtensionSubsystem::NotifyExtensionPointOfExtensions(TSharedPtr<FUIExtensionPoint>& ExtensionPoint)
 {
-	for (FGameplayTag Tag = ExtensionPoint->ExtensionPointTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	// Copied, the chain can't change but registering from a callback can grow the chain map
+	const TArray<FGameplayTag, TInlineAllocator<8>> TagChain(GetTagChain(ExtensionPoint->ExtensionPointTag));
+	for (const FGameplayTag& Tag : TagChain)
 	{
 		if (const FExtensionList* ListPtr = ExtensionMap.Find(Tag))
 		{
 			// Copy in case there are removals while handling callbacks
-			FExtensionList ExtensionArray(*ListPtr);
+			const TArray<TSharedPtr<FUIExtension>, TInlineAllocator<16>> ExtensionArray(*ListPtr);
 
 			for (const TSharedPtr<FUIExtension>& Extension : ExtensionArray)
 			{
-				if (ExtensionPoint->DoesExtensionPassContract(Extension.Get()))
+				if (DoesExtensionPassContract(*ExtensionPoint, *Extension))
 				{
 					FUIExtensionRequest Request = CreateExtensionRequest(Extension);
 					ExtensionPoint->Callback.ExecuteIfBound(EUIExtensionAction::Added, Request);
@@ -209,28 +348,16 @@ void UUIExtensionSubsystem::NotifyExtensionPointOfExtensions(TSharedPtr<FUIExten
 
 void UUIExtensionSubsystem::NotifyExtensionPointsOfExtension(EUIExtensionAction Action, TSharedPtr<FUIExtension>& Extension)
 {
-	bool bOnInitialTag = true;
-	for (FGameplayTag Tag = Extension->ExtensionPointTag; Tag.IsValid(); Tag = Tag.RequestDirectParent())
+	// Copy in case there are removals while handling callbacks
+	const TArray<TSharedPtr<FUIExtensionPoint>, TInlineAllocator<16>> ExtensionPointArray(FindOrAddExtensionPointsForTag(Extension->ExtensionPointTag));
+
+	for (const TSharedPtr<FUIExtensionPoint>& ExtensionPoint : ExtensionPointArray)
 	{
-		if (const FExtensionPointList* ListPtr = ExtensionPointMap.Find(Tag))
+		if (DoesExtensionPassContract(*ExtensionPoint, *Extension))
 		{
-			// Copy in case there are removals while handling callbacks
-			FExtensionPointList ExtensionPointArray(*ListPtr);
-
-			for (const TSharedPtr<FUIExtensionPoint>& ExtensionPoint : ExtensionPointArray)
-			{
-				if (bOnInitialTag || (ExtensionPoint->ExtensionPointTagMatchType == EUIExtensionPointMatch::PartialMatch))
-				{
-					if (ExtensionPoint->DoesExtensionPassContract(Extension.Get()))
-					{
-						FUIExtensionRequest Request = CreateExtensionRequest(Extension);
-						ExtensionPoint->Callback.ExecuteIfBound(Action, Request);
-					}
-				}
-			}
+			FUIExtensionRequest Request = CreateExtensionRequest(Extension);
+			ExtensionPoint->Callback.ExecuteIfBound(Action, Request);
 		}
-		
-		bOnInitialTag = false;
 	}
 }
 
@@ -259,6 +386,7 @@ void UUIExtensionSubsystem::UnregisterExtension(const FUIExtensionHandle& Extens
 			if (ListPtr->Num() == 0)
 			{
 				ExtensionMap.Remove(Extension->ExtensionPointTag);
+				ExtensionPointsByExtensionTag.Remove(Extension->ExtensionPointTag);
 			}
 		}
 	}
@@ -284,6 +412,8 @@ void UUIExtensionSubsystem::UnregisterExtensionPoint(const FUIExtensionPointHand
 			{
 				ExtensionPointMap.Remove(ExtensionPoint->ExtensionPointTag);
 			}
+
+			InvalidateExtensionPointIndex(*ExtensionPoint);
 		}
 	}
 	else
@@ -65,9 +65,20 @@ public:
 	TArray<TObjectPtr<UClass>> AllowedDataClasses;
 	FExtendExtensionPointDelegate Callback;
 
+	// Index of AllowedDataClasses in the owning subsystem's interned contracts, points with the same allowed classes
+	// share cached contract results.
+	int32 ContractIndex = INDEX_NONE;
+
 	// Tests if the extension and the extension point match up, if they do then this extension point should learn
 	// about this extension.
 	bool DoesExtensionPassContract(const FUIExtension* Extension) const;
+
+	// The context half of the contract, cheap and not cacheable since contexts come and go.
+	bool DoesExtensionMatchContext(const FUIExtension* Extension) const;
+
+	// The data class half of the contract, the data can either be a class or an instance of it.
+	static const UClass* GetExtensionDataClass(const FUIExtension* Extension);
+	static bool DoesDataClassPassContract(const UClass* DataClass, const TArray<TObjectPtr<UClass>>& AllowedDataClasses);
 };
 
 /**
@@ -247,6 +258,34 @@ private:
 
 	typedef TArray<TSharedPtr<FUIExtension>> FExtensionList;
 	TMap<FGameplayTag, FExtensionList> ExtensionMap;
+
+	// The tag followed by all of its parents.  The hierarchy of a tag never changes, so it's only walked once per tag.
+	const TArray<FGameplayTag>& GetTagChain(const FGameplayTag& Tag);
+
+	// Can an extension registered at ExtensionTag reach this extension point, ignoring the contract?
+	static bool DoesExtensionPointMatchTag(const FUIExtensionPoint& ExtensionPoint, const FGameplayTag& ExtensionTag, const TArray<FGameplayTag>& ExtensionTagChain);
+
+	const FExtensionPointList& FindOrAddExtensionPointsForTag(const FGameplayTag& ExtensionTag);
+	// Drops the cached lists the extension point belongs in after it was registered or unregistered.
+	void InvalidateExtensionPointIndex(const FUIExtensionPoint& ExtensionPoint);
+
+	// Same as FUIExtensionPoint::DoesExtensionPassContract, with the data class check memoized per (data class, contract).
+	bool DoesExtensionPassContract(const FUIExtensionPoint& ExtensionPoint, const FUIExtension& Extension);
+	int32 FindOrAddContract(const TArray<TObjectPtr<UClass>>& AllowedDataClasses);
+
+#if WITH_EDITOR
+	void HandleObjectsReinstanced(const FCoreUObjectDelegates::FReplacementObjectMap& OldToNewInstanceMap);
+#endif
+
+	TMap<FGameplayTag, TArray<FGameplayTag>> TagChains;
+
+	// For every tag with registered extensions, every extension point those extensions can reach, in notification order.
+	// Lists are dropped when an extension point they include comes or goes, so registering an extension rarely walks
+	// the tag hierarchy.
+	TMap<FGameplayTag, FExtensionPointList> ExtensionPointsByExtensionTag;
+
+	TArray<TArray<TObjectKey<UClass>>> Contracts;
+	TMap<TPair<TObjectKey<UClass>, int32>, bool> ContractResults;
 };
 
 
@@ -20,6 +20,7 @@ public class Gas : ModuleRules
 			"ModularGameplayActors",
 			"NetCore",
 			"PhysicsCore",
+			"ReplicationGraph",
 			"AbilitySystem",
 			"CustomCore",
 			"GameLocalSettings",
@@ -4,18 +4,20 @@
 #include "SignificanceManager.h"
 #include "Character/SharedRepMovement.h"
 
+#include "Character/Components/BaseCharacterMovementComponent.h"
 #include "Character/Components/HealthComponent.h"
 #include "Component/BaseAbilitySystemComponent.h"
 #include "Character/Components/PawnExtensionComponent.h"
 #include "Components/CapsuleComponent.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "Net/UnrealNetwork.h"
 #include "Player/BasePlayerController.h"
 #include "Player/BasePlayerState.h"
 #include "Tags/BaseGameplayTags.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(BaseCharacter)
 
-ABaseCharacter::ABaseCharacter(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
+ABaseCharacter::ABaseCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UBaseCharacterMovementComponent>(CharacterMovementComponentName))
 {
 	// Avoid ticking characters if possible.
 	PrimaryActorTick.bCanEverTick = false;
@@ -51,6 +53,8 @@ ABasePlayerState* ABaseCharacter::GetBasePlayerState() const { return CastChecke
 
 UBaseAbilitySystemComponent* ABaseCharacter::GetBaseAbilitySystemComponent() const { return Cast<UBaseAbilitySystemComponent>(GetAbilitySystemComponent()); }
 
+UBaseCharacterMovementComponent* ABaseCharacter::GetBaseCharacterMovement() const { return CastChecked<UBaseCharacterMovementComponent>(GetCharacterMovement(), ECastCheckedType::NullAllowed); }
+
 UAbilitySystemComponent* ABaseCharacter::GetAbilitySystemComponent() const
 {
 	if (PawnExtComponent) return PawnExtComponent->GetBaseAbilitySystemComponent();
@@ -94,9 +98,26 @@ void ABaseCharacter::Reset()
 	UninitAndDestroy();
 }
 
-void ABaseCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const { Super::GetLifetimeReplicatedProps(OutLifetimeProps); }
+void ABaseCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-void ABaseCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) {}
+	FDoRepLifetimeParams SharedParams;
+	SharedParams.bIsPushBased = true;
+	SharedParams.Condition = COND_SimulatedOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ThisClass, ReplicatedAcceleration, SharedParams);
+}
+
+void ABaseCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// Three bytes instead of a full vector, and only sent when the quantized value moves
+	if (const UCharacterMovementComponent* MovementComponent = GetCharacterMovement())
+	{
+		SetReplicatedAcceleration(FBaseReplicatedAcceleration::Pack(MovementComponent->GetCurrentAcceleration(), MovementComponent->GetMaxAcceleration()));
+	}
+}
 
 void ABaseCharacter::NotifyControllerChanged() {}
 
@@ -171,9 +192,16 @@ void ABaseCharacter::FastSharedReplication_Implementation(const FSharedRepMoveme
 		GetCharacterMovement()->bNetworkUpdateReceived = true;
 	}
 
-	// Location, Rotation, Velocity, etc.
+	// Location, Rotation, Velocity, etc. Our own quantization levels are kept, the regular ReplicatedMovement property
+	// is still decoded with them
 	FRepMovement& MutableRepMovement = GetReplicatedMovement_Mutable();
+	const EVectorQuantization LocationQuantizationLevel = MutableRepMovement.LocationQuantizationLevel;
+	const EVectorQuantization VelocityQuantizationLevel = MutableRepMovement.VelocityQuantizationLevel;
+	const ERotatorQuantization RotationQuantizationLevel = MutableRepMovement.RotationQuantizationLevel;
 	MutableRepMovement = SharedRepMovement.RepMovement;
+	MutableRepMovement.LocationQuantizationLevel = LocationQuantizationLevel;
+	MutableRepMovement.VelocityQuantizationLevel = VelocityQuantizationLevel;
+	MutableRepMovement.RotationQuantizationLevel = RotationQuantizationLevel;
 
 	// This also sets LastRepMovement
 	OnRep_ReplicatedMovement();
@@ -187,6 +215,12 @@ void ABaseCharacter::FastSharedReplication_Implementation(const FSharedRepMoveme
 		bIsCrouched = SharedRepMovement.bIsCrouched;
 		OnRep_IsCrouched();
 	}
+	// Acceleration
+	if (ReplicatedAcceleration != SharedRepMovement.RepAcceleration)
+	{
+		ReplicatedAcceleration = SharedRepMovement.RepAcceleration;
+		OnRep_ReplicatedAcceleration();
+	}
 }
 
 void ABaseCharacter::OnAbilitySystemInitialized()
@@ -334,4 +368,17 @@ bool ABaseCharacter::CanJumpInternal_Implementation() const
 	return JumpIsAllowedInternal();
 }
 
-void ABaseCharacter::OnRep_ReplicatedAcceleration() const {}
\ No newline at end of file
+void ABaseCharacter::SetReplicatedAcceleration(const FBaseReplicatedAcceleration& NewAcceleration)
+{
+	if (ReplicatedAcceleration == NewAcceleration) return;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ThisClass, ReplicatedAcceleration, this);
+	ReplicatedAcceleration = NewAcceleration;
+}
+
+void ABaseCharacter::OnRep_ReplicatedAcceleration()
+{
+	if (UBaseCharacterMovementComponent* MovementComponent = GetBaseCharacterMovement())
+	{
+		MovementComponent->SetReplicatedAcceleration(ReplicatedAcceleration.Unpack(MovementComponent->GetMaxAcceleration()));
+	}
+}
\ No newline at end of file
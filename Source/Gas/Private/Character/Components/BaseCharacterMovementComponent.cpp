@@ -0,0 +1,25 @@
+#include "Character/Components/BaseCharacterMovementComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(BaseCharacterMovementComponent)
+
+UBaseCharacterMovementComponent::UBaseCharacterMovementComponent(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {}
+
+void UBaseCharacterMovementComponent::SetReplicatedAcceleration(const FVector& InAcceleration)
+{
+	bHasReplicatedAcceleration = true;
+	Acceleration = InAcceleration;
+}
+
+void UBaseCharacterMovementComponent::SimulateMovement(const float DeltaTime)
+{
+	if (!bHasReplicatedAcceleration)
+	{
+		Super::SimulateMovement(DeltaTime);
+		return;
+	}
+
+	// SimulateMovement overwrites the acceleration with the velocity direction, keep the replicated one
+	const FVector ReplicatedAcceleration = Acceleration;
+	Super::SimulateMovement(DeltaTime);
+	Acceleration = ReplicatedAcceleration;
+}
@@ -0,0 +1,44 @@
+#include "Character/ReplicatedAcceleration.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ReplicatedAcceleration)
+
+FBaseReplicatedAcceleration FBaseReplicatedAcceleration::Pack(const FVector& Acceleration, const float MaxAcceleration)
+{
+	FBaseReplicatedAcceleration Packed;
+	if (MaxAcceleration <= 0.f)
+	{
+		return Packed;
+	}
+
+	const double Size = Acceleration.Size();
+	Packed.Magnitude = static_cast<uint8>(FMath::Clamp(FMath::RoundToInt(Size / MaxAcceleration * 255.0), 0, 255));
+
+	// Leave the direction at zero when there is nothing to point at, so a stopped character always packs the same way
+	if (Packed.Magnitude == 0)
+	{
+		return Packed;
+	}
+
+	const double AzimuthTurns = FMath::Fmod(FMath::Atan2(Acceleration.Y, Acceleration.X) / UE_DOUBLE_TWO_PI + 1.0, 1.0);
+	const double ElevationRadians = FMath::Asin(FMath::Clamp(Acceleration.Z / Size, -1.0, 1.0));
+
+	Packed.Azimuth = static_cast<uint8>(FMath::RoundToInt(AzimuthTurns * 256.0) & 0xFF);
+	Packed.Elevation = static_cast<int8>(FMath::Clamp(FMath::RoundToInt(ElevationRadians / UE_DOUBLE_HALF_PI * 127.0), -127, 127));
+
+	return Packed;
+}
+
+FVector FBaseReplicatedAcceleration::Unpack(const float MaxAcceleration) const
+{
+	if (IsZero())
+	{
+		return FVector::ZeroVector;
+	}
+
+	double SinAzimuth, CosAzimuth, SinElevation, CosElevation;
+	FMath::SinCos(&SinAzimuth, &CosAzimuth, Azimuth / 256.0 * UE_DOUBLE_TWO_PI);
+	FMath::SinCos(&SinElevation, &CosElevation, Elevation / 127.0 * UE_DOUBLE_HALF_PI);
+
+	const double Size = Magnitude / 255.0 * MaxAcceleration;
+	return FVector(CosElevation * CosAzimuth, CosElevation * SinAzimuth, SinElevation) * Size;
+}
@@ -2,9 +2,175 @@
 
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Log/Log.h"
+#include "UObject/CoreNet.h"
+#include "UObject/ObjectKey.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SharedRepMovement)
 
+namespace SharedRepMovementCvars
+{
+	static int32 LocationQuantization = 2;
+	static FAutoConsoleVariableRef CVarLocationQuantization(
+		TEXT("Gas.SharedRepMovement.LocationQuantization"),
+		LocationQuantization,
+		TEXT("Location precision of fast shared movement updates. 0: whole cm, 1: one decimal, 2: two decimals"),
+		ECVF_Default);
+
+	static int32 VelocityQuantization = 0;
+	static FAutoConsoleVariableRef CVarVelocityQuantization(
+		TEXT("Gas.SharedRepMovement.VelocityQuantization"),
+		VelocityQuantization,
+		TEXT("Velocity precision of fast shared movement updates. 0: whole cm/s, 1: one decimal, 2: two decimals"),
+		ECVF_Default);
+
+	static int32 RotationQuantization = 0;
+	static FAutoConsoleVariableRef CVarRotationQuantization(
+		TEXT("Gas.SharedRepMovement.RotationQuantization"),
+		RotationQuantization,
+		TEXT("Rotation precision of fast shared movement updates. 0: 8 bits per component, 1: 16 bits per component"),
+		ECVF_Default);
+
+	static int32 MaxBitsPerUpdate = 0;
+	static FAutoConsoleVariableRef CVarMaxBitsPerUpdate(
+		TEXT("Gas.SharedRepMovement.MaxBitsPerUpdate"),
+		MaxBitsPerUpdate,
+		TEXT("When > 0, precision is lowered (velocity, then location, then rotation) until an update fits in this many bits"),
+		ECVF_Default);
+
+	static float LocationTolerance = 0.05f;
+	static FAutoConsoleVariableRef CVarLocationTolerance(
+		TEXT("Gas.SharedRepMovement.LocationTolerance"),
+		LocationTolerance,
+		TEXT("Location change (cm, per axis) below which no new fast shared update is sent"),
+		ECVF_Default);
+
+	static float VelocityTolerance = 0.5f;
+	static FAutoConsoleVariableRef CVarVelocityTolerance(
+		TEXT("Gas.SharedRepMovement.VelocityTolerance"),
+		VelocityTolerance,
+		TEXT("Velocity change (cm/s, per axis) below which no new fast shared update is sent"),
+		ECVF_Default);
+
+	static float RotationTolerance = 0.1f;
+	static FAutoConsoleVariableRef CVarRotationTolerance(
+		TEXT("Gas.SharedRepMovement.RotationTolerance"),
+		RotationTolerance,
+		TEXT("Rotation change (degrees, per axis) below which no new fast shared update is sent"),
+		ECVF_Default);
+
+	static bool bRecord = false;
+	static FAutoConsoleVariableRef CVarRecord(
+		TEXT("Gas.SharedRepMovement.Record"),
+		bRecord,
+		TEXT("When true, the server records the unquantized movement of every character for Gas.SharedRepMovement.Replay"),
+		ECVF_Default);
+
+	static int32 MaxRecordedSamples = 36000;
+	static FAutoConsoleVariableRef CVarMaxRecordedSamples(
+		TEXT("Gas.SharedRepMovement.MaxRecordedSamples"),
+		MaxRecordedSamples,
+		TEXT("Recording stops adding samples past this count (all characters together)"),
+		ECVF_Default);
+
+	static EVectorQuantization ToVectorQuantization(const int32 Level)
+	{
+		return static_cast<EVectorQuantization>(FMath::Clamp(Level, 0, static_cast<int32>(EVectorQuantization::RoundTwoDecimals)));
+	}
+
+	static bool Coarsen(EVectorQuantization& Level)
+	{
+		if (Level == EVectorQuantization::RoundWholeNumber) return false;
+		Level = static_cast<EVectorQuantization>(static_cast<uint8>(Level) - 1);
+		return true;
+	}
+}
+
+namespace SharedRepMovementReplay
+{
+	// Unquantized samples in fill order, per character so the skip logic of Equals replays like it ran
+	static TMap<FObjectKey, TArray<FSharedRepMovement>> RecordedMovement;
+	static int32 NumRecordedSamples = 0;
+
+	static void Record(const ACharacter* Character, const FSharedRepMovement& Movement)
+	{
+		if (NumRecordedSamples >= SharedRepMovementCvars::MaxRecordedSamples) return;
+		RecordedMovement.FindOrAdd(FObjectKey(Character)).Add(Movement);
+		++NumRecordedSamples;
+	}
+
+	static FAutoConsoleCommand CmdReset(
+		TEXT("Gas.SharedRepMovement.ResetRecording"),
+		TEXT("Drops the movement recorded with Gas.SharedRepMovement.Record"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			RecordedMovement.Reset();
+			NumRecordedSamples = 0;
+		}));
+
+	static FAutoConsoleCommand CmdReplay(
+		TEXT("Gas.SharedRepMovement.Replay"),
+		TEXT("Runs the recorded movement through the fast shared serializer with the current settings, logs bytes per update and reconstruction error"),
+		FConsoleCommandDelegate::CreateLambda([]()
+		{
+			int32 NumSamples = 0;
+			int32 NumSent = 0;
+			int64 SentBits = 0;
+			double SumLocationError = 0.0;
+			double MaxLocationError = 0.0;
+			double MaxVelocityError = 0.0;
+			double MaxRotationError = 0.0;
+
+			for (const TPair<FObjectKey, TArray<FSharedRepMovement>>& Pair : RecordedMovement)
+			{
+				// What the clients hold: the last update that went through the serializer
+				FSharedRepMovement Received;
+				FSharedRepMovement LastSent;
+				bool bSentAny = false;
+
+				for (FSharedRepMovement Sample : Pair.Value)
+				{
+					Sample.ApplyQuantizationLevels();
+					++NumSamples;
+
+					if (!bSentAny || !Sample.Equals(LastSent, nullptr))
+					{
+						FNetBitWriter Writer(nullptr, 256);
+						bool bSuccess = true;
+						Sample.NetSerialize(Writer, nullptr, bSuccess);
+
+						FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+						Received.NetSerialize(Reader, nullptr, bSuccess);
+
+						LastSent = Sample;
+						bSentAny = true;
+						++NumSent;
+						SentBits += Writer.GetNumBits();
+					}
+
+					const double LocationError = FVector::Dist(Sample.RepMovement.Location, Received.RepMovement.Location);
+					SumLocationError += LocationError;
+					MaxLocationError = FMath::Max(MaxLocationError, LocationError);
+					MaxVelocityError = FMath::Max(MaxVelocityError, FVector::Dist(Sample.RepMovement.LinearVelocity, Received.RepMovement.LinearVelocity));
+					const FRotator RotationDelta = (Sample.RepMovement.Rotation - Received.RepMovement.Rotation).GetNormalized();
+					MaxRotationError = FMath::Max(MaxRotationError, FMath::Max3(FMath::Abs(RotationDelta.Pitch), FMath::Abs(RotationDelta.Yaw), FMath::Abs(RotationDelta.Roll)));
+				}
+			}
+
+			if (NumSamples == 0)
+			{
+				ULOG_WARNING(LogGAS, "Gas.SharedRepMovement.Replay: nothing recorded, set Gas.SharedRepMovement.Record 1 on the server first");
+				return;
+			}
+
+			ULOG_INFO(LogGAS, "%d samples over %d characters, %d sent (%.1f%%), %.2f bytes per sent update",
+			          NumSamples, RecordedMovement.Num(), NumSent, 100.0 * NumSent / NumSamples,
+			          NumSent > 0 ? SentBits / 8.0 / NumSent : 0.0);
+			ULOG_INFO(LogGAS, "Location error %.3f cm avg, %.3f cm max. Velocity error %.3f cm/s max. Rotation error %.3f deg max",
+			          SumLocationError / NumSamples, MaxLocationError, MaxVelocityError, MaxRotationError);
+		}));
+}
+
 FSharedRepMovement::FSharedRepMovement()
 {
 	RepMovement.LocationQuantizationLevel = EVectorQuantization::RoundTwoDecimals;
@@ -27,6 +193,7 @@ bool FSharedRepMovement::FillForCharacter(const ACharacter* Character)
 	RepMovementMode = CharacterMovement->PackNetworkMovementMode();
 	bProxyIsJumpForceApplied = Character->bProxyIsJumpForceApplied || (Character->JumpForceTimeRemaining > 0.0f);
 	bIsCrouched = Character->bIsCrouched;
+	RepAcceleration = FBaseReplicatedAcceleration::Pack(CharacterMovement->GetCurrentAcceleration(), CharacterMovement->GetMaxAcceleration());
 
 	// Timestamp is sent as zero if unused
 	RepTimeStamp = 0.f;
@@ -36,23 +203,71 @@ bool FSharedRepMovement::FillForCharacter(const ACharacter* Character)
 		RepTimeStamp = CharacterMovement->GetServerLastTransformUpdateTimeStamp();
 	}
 
+	if (SharedRepMovementCvars::bRecord)
+	{
+		SharedRepMovementReplay::Record(Character, *this);
+	}
+
+	ApplyQuantizationLevels();
 
 	return true;
 }
 
+void FSharedRepMovement::ApplyQuantizationLevels()
+{
+	using namespace SharedRepMovementCvars;
+
+	RepMovement.LocationQuantizationLevel = ToVectorQuantization(LocationQuantization);
+	RepMovement.VelocityQuantizationLevel = ToVectorQuantization(VelocityQuantization);
+	RepMovement.RotationQuantizationLevel = RotationQuantization > 0 ? ERotatorQuantization::ShortComponents : ERotatorQuantization::ByteComponents;
+
+	if (MaxBitsPerUpdate <= 0)
+	{
+		return;
+	}
+
+	while (GetSerializedBits() > MaxBitsPerUpdate)
+	{
+		if (Coarsen(RepMovement.VelocityQuantizationLevel) || Coarsen(RepMovement.LocationQuantizationLevel))
+		{
+			continue;
+		}
+
+		if (RepMovement.RotationQuantizationLevel == ERotatorQuantization::ShortComponents)
+		{
+			RepMovement.RotationQuantizationLevel = ERotatorQuantization::ByteComponents;
+			continue;
+		}
+
+		// Already at the lowest precision, send it over budget
+		break;
+	}
+}
+
+int64 FSharedRepMovement::GetSerializedBits() const
+{
+	FSharedRepMovement Copy = *this;
+	FNetBitWriter Writer(nullptr, 256);
+	bool bSuccess = true;
+	Copy.NetSerialize(Writer, nullptr, bSuccess);
+	return Writer.GetNumBits();
+}
+
 bool FSharedRepMovement::Equals(const FSharedRepMovement& Other, ACharacter* Character) const
 {
-	if (RepMovement.Location != Other.RepMovement.Location)
+	// Changes below the tolerances (and below what the quantization can represent anyway) don't warrant a new update.
+	// Other is the last update sent, so the error on the clients never exceeds the tolerance.
+	if (!RepMovement.Location.Equals(Other.RepMovement.Location, SharedRepMovementCvars::LocationTolerance))
 	{
 		return false;
 	}
 
-	if (RepMovement.Rotation != Other.RepMovement.Rotation)
+	if (!RepMovement.Rotation.Equals(Other.RepMovement.Rotation, SharedRepMovementCvars::RotationTolerance))
 	{
 		return false;
 	}
 
-	if (RepMovement.LinearVelocity != Other.RepMovement.LinearVelocity)
+	if (!RepMovement.LinearVelocity.Equals(Other.RepMovement.LinearVelocity, SharedRepMovementCvars::VelocityTolerance))
 	{
 		return false;
 	}
@@ -72,6 +287,11 @@ bool FSharedRepMovement::Equals(const FSharedRepMovement& Other, ACharacter* Cha
 		return false;
 	}
 
+	if (RepAcceleration != Other.RepAcceleration)
+	{
+		return false;
+	}
+
 	return true;
 }
 
@@ -79,6 +299,22 @@ bool FSharedRepMovement::Equals(const FSharedRepMovement& Other, ACharacter* Cha
 bool FSharedRepMovement::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
 {
 	bOutSuccess = true;
+
+	// Quantization levels change per update, FRepMovement doesn't send them so they go first
+	uint8 LocationLevel = static_cast<uint8>(RepMovement.LocationQuantizationLevel);
+	uint8 VelocityLevel = static_cast<uint8>(RepMovement.VelocityQuantizationLevel);
+	uint8 bShortRotation = RepMovement.RotationQuantizationLevel == ERotatorQuantization::ShortComponents;
+	Ar.SerializeBits(&LocationLevel, 2);
+	Ar.SerializeBits(&VelocityLevel, 2);
+	Ar.SerializeBits(&bShortRotation, 1);
+
+	if (Ar.IsLoading())
+	{
+		RepMovement.LocationQuantizationLevel = SharedRepMovementCvars::ToVectorQuantization(LocationLevel);
+		RepMovement.VelocityQuantizationLevel = SharedRepMovementCvars::ToVectorQuantization(VelocityLevel);
+		RepMovement.RotationQuantizationLevel = bShortRotation ? ERotatorQuantization::ShortComponents : ERotatorQuantization::ByteComponents;
+	}
+
 	RepMovement.NetSerialize(Ar, Map, bOutSuccess);
 	Ar << RepMovementMode;
 	Ar << bProxyIsJumpForceApplied;
@@ -97,5 +333,20 @@ bool FSharedRepMovement::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool
 		RepTimeStamp = 0.f;
 	}
 
+	// Acceleration, if non-zero. Direction bytes are only meaningful with a magnitude.
+	uint8 bHasAcceleration = !RepAcceleration.IsZero();
+	Ar.SerializeBits(&bHasAcceleration, 1);
+
+	if (bHasAcceleration)
+	{
+		Ar << RepAcceleration.Azimuth;
+		Ar << RepAcceleration.Elevation;
+		Ar << RepAcceleration.Magnitude;
+	}
+	else
+	{
+		RepAcceleration = FBaseReplicatedAcceleration();
+	}
+
 	return true;
 }
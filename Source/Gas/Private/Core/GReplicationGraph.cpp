@@ -0,0 +1,483 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/GReplicationGraph.h"
+
+#include "Character/BaseCharacter.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Log/Log.h"
+#include "UObject/UObjectIterator.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(GReplicationGraph)
+
+namespace GRepGraphCvars
+{
+	static bool bEnableReplicationGraph = true;
+	static FAutoConsoleVariableRef CVarEnableReplicationGraph(
+		TEXT("Gas.RepGraph.Enable"),
+		bEnableReplicationGraph,
+		TEXT("When true, the game net driver uses UGReplicationGraph. Read when the net driver is created"),
+		ECVF_Default);
+
+	static float CellSize = 10000.0f;
+	static FAutoConsoleVariableRef CVarCellSize(
+		TEXT("Gas.RepGraph.CellSize"),
+		CellSize,
+		TEXT("Size of a cell of the spatial grid characters are routed into (cm)"),
+		ECVF_Default);
+
+	static float SpatialBiasX = -200000.0f;
+	static FAutoConsoleVariableRef CVarSpatialBiasX(
+		TEXT("Gas.RepGraph.SpatialBiasX"),
+		SpatialBiasX,
+		TEXT("Origin of the spatial grid on X. The grid only grows towards positive coordinates"),
+		ECVF_Default);
+
+	static float SpatialBiasY = -200000.0f;
+	static FAutoConsoleVariableRef CVarSpatialBiasY(
+		TEXT("Gas.RepGraph.SpatialBiasY"),
+		SpatialBiasY,
+		TEXT("Origin of the spatial grid on Y. The grid only grows towards positive coordinates"),
+		ECVF_Default);
+
+	static bool bEnableFastSharedPath = true;
+	static FAutoConsoleVariableRef CVarEnableFastSharedPath(
+		TEXT("Gas.RepGraph.EnableFastSharedPath"),
+		bEnableFastSharedPath,
+		TEXT("When true, character movement is sent through FastSharedReplication, serialized once per frame for every connection"),
+		ECVF_Default);
+
+	static int32 TargetKBytesSecFastSharedPath = 10;
+	static FAutoConsoleVariableRef CVarTargetKBytesSecFastSharedPath(
+		TEXT("Gas.RepGraph.TargetKBytesSecFastSharedPath"),
+		TargetKBytesSecFastSharedPath,
+		TEXT("Bandwidth budget of the fast shared path per connection (KB/s)"),
+		ECVF_Default);
+
+	static float FastSharedPathCullDistPct = 0.80f;
+	static FAutoConsoleVariableRef CVarFastSharedPathCullDistPct(
+		TEXT("Gas.RepGraph.FastSharedPathCullDistPct"),
+		FastSharedPathCullDistPct,
+		TEXT("Fraction of the cull distance within which the fast shared path is used"),
+		ECVF_Default);
+
+	static int32 PlayerStatesPerFrame = 2;
+	static FAutoConsoleVariableRef CVarPlayerStatesPerFrame(
+		TEXT("Gas.RepGraph.PlayerStatesPerFrame"),
+		PlayerStatesPerFrame,
+		TEXT("How many other players' player states are sent to a connection per frame"),
+		ECVF_Default);
+
+	static float DestructionInfoMaxDist = 30000.0f;
+	static FAutoConsoleVariableRef CVarDestructionInfoMaxDist(
+		TEXT("Gas.RepGraph.DestructionInfoMaxDist"),
+		DestructionInfoMaxDist,
+		TEXT("Connections further than this from a destroyed startup actor do not get its destruction info"),
+		ECVF_Default);
+
+	static FAutoConsoleCommandWithWorld CmdPrintConnectionStats(
+		TEXT("Gas.RepGraph.PrintConnectionStats"),
+		TEXT("Logs the server frame time and the outgoing bandwidth of every client connection of the game net driver"),
+		FConsoleCommandWithWorldDelegate::CreateLambda([](const UWorld* World)
+		{
+			const UNetDriver* NetDriver = World ? World->GetNetDriver() : nullptr;
+			if (!NetDriver || !NetDriver->IsServer())
+			{
+				ULOG_WARNING(LogGAS, "Gas.RepGraph.PrintConnectionStats: not a server");
+				return;
+			}
+
+			int64 TotalOutBytesPerSecond = 0;
+			for (const UNetConnection* Connection : NetDriver->ClientConnections)
+			{
+				if (!Connection) continue;
+				TotalOutBytesPerSecond += Connection->OutBytesPerSecond;
+				ULOG_INFO(LogGAS, "  %s: %d B/s out, %d B/s in", *Connection->LowLevelGetRemoteAddress(true),
+				          Connection->OutBytesPerSecond, Connection->InBytesPerSecond);
+			}
+
+			const int32 NumConnections = NetDriver->ClientConnections.Num();
+			ULOG_INFO(LogGAS, "%d connections, game thread %.2f ms, %.0f B/s out per connection (graph: %s)", NumConnections,
+			          FPlatformTime::ToMilliseconds(GGameThreadTime),
+			          NumConnections > 0 ? static_cast<double>(TotalOutBytesPerSecond) / NumConnections : 0.0,
+			          *GetNameSafe(NetDriver->GetReplicationDriver()));
+		}));
+
+	UReplicationDriver* ConditionalCreateReplicationDriver(UNetDriver* ForNetDriver, UWorld* World)
+	{
+		// Only the game net driver of game worlds gets the graph (not beacons, demo drivers, editor worlds)
+		if (!bEnableReplicationGraph || !World || !World->IsGameWorld() || !ForNetDriver ||
+			ForNetDriver->NetDriverName != NAME_GameNetDriver)
+			return nullptr;
+
+		return NewObject<UGReplicationGraph>(GetTransientPackage());
+	}
+}
+
+#pragma region UGReplicationGraph
+UGReplicationGraph::UGReplicationGraph()
+{
+	if (!UReplicationDriver::CreateReplicationDriverDelegate().IsBound())
+	{
+		UReplicationDriver::CreateReplicationDriverDelegate().BindLambda(
+			[](UNetDriver* ForNetDriver, const FURL& URL, UWorld* World) -> UReplicationDriver*
+			{
+				return GRepGraphCvars::ConditionalCreateReplicationDriver(ForNetDriver, World);
+			});
+	}
+}
+
+void UGReplicationGraph::ResetGameWorldState()
+{
+	Super::ResetGameWorldState();
+
+	AlwaysRelevantStreamingLevelActors.Empty();
+
+	auto ResetConnections = [](const auto& ConnectionManagers)
+	{
+		for (UNetReplicationGraphConnection* ConnectionManager : ConnectionManagers)
+		{
+			for (UReplicationGraphNode* ConnectionNode : ConnectionManager->GetConnectionGraphNodes())
+			{
+				if (auto* AlwaysRelevantNode = Cast<UGReplicationGraphNode_AlwaysRelevant_ForConnection>(ConnectionNode))
+					AlwaysRelevantNode->ResetGameWorldState();
+			}
+		}
+	};
+	ResetConnections(Connections);
+	ResetConnections(PendingConnections);
+}
+
+EGClassRepNodeMapping UGReplicationGraph::GetClassNodeMapping(UClass* Class) const
+{
+	if (!Class) return EGClassRepNodeMapping::NotRouted;
+
+	if (const EGClassRepNodeMapping* Ptr = ClassRepNodePolicies.FindWithoutClassRecursion(Class)) return *Ptr;
+
+	const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+	if (!ActorCDO || !ActorCDO->GetIsReplicated()) return EGClassRepNodeMapping::NotRouted;
+
+	// Same relevancy settings as the parent class means the same route
+	UClass* SuperClass = Class->GetSuperClass();
+	if (const AActor* SuperCDO = Cast<AActor>(SuperClass->GetDefaultObject()))
+	{
+		if (SuperCDO->GetIsReplicated() == ActorCDO->GetIsReplicated()
+			&& SuperCDO->bAlwaysRelevant == ActorCDO->bAlwaysRelevant
+			&& SuperCDO->bOnlyRelevantToOwner == ActorCDO->bOnlyRelevantToOwner
+			&& SuperCDO->bNetUseOwnerRelevancy == ActorCDO->bNetUseOwnerRelevancy
+			&& SuperCDO->NetDormancy == ActorCDO->NetDormancy)
+			return GetClassNodeMapping(SuperClass);
+	}
+
+	const bool bSpatialize = !(ActorCDO->bAlwaysRelevant || ActorCDO->bOnlyRelevantToOwner || ActorCDO->bNetUseOwnerRelevancy);
+	if (bSpatialize)
+		return ActorCDO->NetDormancy > DORM_Awake ? EGClassRepNodeMapping::Spatialize_Dormancy : EGClassRepNodeMapping::Spatialize_Dynamic;
+
+	if (ActorCDO->bAlwaysRelevant && !ActorCDO->bOnlyRelevantToOwner) return EGClassRepNodeMapping::RelevantAllConnections;
+
+	// Owner relevant actors are replicated through their owner
+	return EGClassRepNodeMapping::NotRouted;
+}
+
+void UGReplicationGraph::RegisterClassRepNodeMapping(UClass* Class)
+{
+	const EGClassRepNodeMapping Mapping = GetClassNodeMapping(Class);
+	ClassRepNodePolicies.Set(Class, Mapping);
+}
+
+EGClassRepNodeMapping UGReplicationGraph::GetMappingPolicy(UClass* Class)
+{
+	const EGClassRepNodeMapping* PolicyPtr = ClassRepNodePolicies.Get(Class);
+	return PolicyPtr ? *PolicyPtr : EGClassRepNodeMapping::NotRouted;
+}
+
+void UGReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, const bool bSpatialize) const
+{
+	const AActor* CDO = Class->GetDefaultObject<AActor>();
+	if (bSpatialize) Info.SetCullDistanceSquared(CDO->GetNetCullDistanceSquared());
+
+	const float ServerMaxTickRate = NetDriver->GetNetServerMaxTickRate();
+	Info.ReplicationPeriodFrame = static_cast<uint16>(FMath::Max(
+		FMath::RoundToInt(ServerMaxTickRate / FMath::Max(CDO->GetNetUpdateFrequency(), 1.0f)), 1));
+}
+
+void UGReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// Explicit routes, everything else is derived from the class defaults
+	ClassRepNodePolicies.Set(AReplicationGraphDebugActor::StaticClass(), EGClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), EGClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), EGClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), EGClassRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(ABaseCharacter::StaticClass(), EGClassRepNodeMapping::Spatialize_Dynamic);
+
+	for (const TSoftClassPtr<AActor>& DormantClass : DormancyRoutedActorClasses)
+	{
+		if (UClass* Class = DormantClass.LoadSynchronous())
+			ClassRepNodePolicies.Set(Class, EGClassRepNodeMapping::Spatialize_Dormancy);
+		else
+			ULOG_WARNING(LogGAS, "DormancyRoutedActorClasses entry '%s' could not be loaded", *DormantClass.ToString());
+	}
+
+	TArray<UClass*> AllReplicatedClasses;
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+		if (!ActorCDO || !ActorCDO->GetIsReplicated()) continue;
+
+		// Skip blueprint skeleton and reinstancing classes
+		if (Class->GetName().StartsWith(TEXT("SKEL_")) || Class->GetName().StartsWith(TEXT("REINST_"))) continue;
+
+		AllReplicatedClasses.Add(Class);
+		RegisterClassRepNodeMapping(Class);
+	}
+
+	TArray<UClass*> ExplicitlySetClasses;
+	auto SetClassInfo = [&](UClass* Class, const FClassReplicationInfo& Info)
+	{
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, Info);
+		ExplicitlySetClasses.Add(Class);
+	};
+
+	FClassReplicationInfo CharacterClassRepInfo;
+	CharacterClassRepInfo.DistancePriorityScale = 1.0f;
+	CharacterClassRepInfo.StarvationPriorityScale = 1.0f;
+	CharacterClassRepInfo.ActorChannelFrameTimeout = 4;
+	CharacterClassRepInfo.SetCullDistanceSquared(GetDefault<ABaseCharacter>()->GetNetCullDistanceSquared());
+	SetClassInfo(ACharacter::StaticClass(), CharacterClassRepInfo);
+
+	if (GRepGraphCvars::bEnableFastSharedPath)
+	{
+		// On frames a character is not replicated through its properties, the graph calls UpdateSharedReplication once
+		// and sends the resulting FastSharedReplication bunch, serialized once, to every connection that needs it
+		CharacterClassRepInfo.FastSharedReplicationFunc = [](AActor* Actor)
+		{
+			ABaseCharacter* Character = Cast<ABaseCharacter>(Actor);
+			return Character && Character->UpdateSharedReplication();
+		};
+		CharacterClassRepInfo.FastSharedReplicationFuncName = GET_FUNCTION_NAME_CHECKED(ABaseCharacter, FastSharedReplication);
+
+		FastSharedPathConstants.MaxBitsPerFrame = static_cast<int32>(
+			static_cast<float>(GRepGraphCvars::TargetKBytesSecFastSharedPath * 1024 * 8) / NetDriver->GetNetServerMaxTickRate());
+		FastSharedPathConstants.DistanceRequirementPct = GRepGraphCvars::FastSharedPathCullDistPct;
+	}
+	SetClassInfo(ABaseCharacter::StaticClass(), CharacterClassRepInfo);
+
+	FClassReplicationInfo PlayerStateRepInfo;
+	PlayerStateRepInfo.DistancePriorityScale = 0.0f;
+	PlayerStateRepInfo.ActorChannelFrameTimeout = 0;
+	SetClassInfo(APlayerState::StaticClass(), PlayerStateRepInfo);
+
+	// Everything else keeps the behaviour of its legacy net settings
+	for (UClass* ReplicatedClass : AllReplicatedClasses)
+	{
+		if (ExplicitlySetClasses.ContainsByPredicate([ReplicatedClass](const UClass* SetClass) { return ReplicatedClass->IsChildOf(SetClass); }))
+			continue;
+
+		FClassReplicationInfo ClassInfo;
+		InitClassReplicationInfo(ClassInfo, ReplicatedClass, IsSpatialized(GetMappingPolicy(ReplicatedClass)));
+		GlobalActorReplicationInfoMap.SetClassInfo(ReplicatedClass, ClassInfo);
+	}
+
+	DestructInfoMaxDistanceSquared = FMath::Square(GRepGraphCvars::DestructionInfoMaxDist);
+}
+
+void UGReplicationGraph::InitGlobalGraphNodes()
+{
+	GridNode = CreateNewNode<UReplicationGraphNode_GridSpatialization2D>();
+	GridNode->CellSize = GRepGraphCvars::CellSize;
+	GridNode->SpatialBias = FVector2D(GRepGraphCvars::SpatialBiasX, GRepGraphCvars::SpatialBiasY);
+	AddGlobalGraphNode(GridNode);
+
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	UGReplicationGraphNode_PlayerStateFrequencyLimiter* PlayerStateNode = CreateNewNode<UGReplicationGraphNode_PlayerStateFrequencyLimiter>();
+	PlayerStateNode->TargetActorsPerFrame = FMath::Max(GRepGraphCvars::PlayerStatesPerFrame, 1);
+	AddGlobalGraphNode(PlayerStateNode);
+}
+
+void UGReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection)
+{
+	Super::InitConnectionGraphNodes(RepGraphConnection);
+
+	UGReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantConnectionNode = CreateNewNode<UGReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	RepGraphConnection->OnClientVisibleLevelNameAdd.AddUObject(AlwaysRelevantConnectionNode, &UGReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityAdd);
+	RepGraphConnection->OnClientVisibleLevelNameRemove.AddUObject(AlwaysRelevantConnectionNode, &UGReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityRemove);
+	AddConnectionGraphNode(AlwaysRelevantConnectionNode, RepGraphConnection);
+}
+
+void UGReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EGClassRepNodeMapping::NotRouted: break;
+	case EGClassRepNodeMapping::RelevantAllConnections:
+		if (ActorInfo.StreamingLevelName == NAME_None) AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		else AlwaysRelevantStreamingLevelActors.FindOrAdd(ActorInfo.StreamingLevelName).ConditionalAdd(ActorInfo.Actor);
+		break;
+	case EGClassRepNodeMapping::Spatialize_Static: GridNode->AddActor_Static(ActorInfo, GlobalInfo);
+		break;
+	case EGClassRepNodeMapping::Spatialize_Dynamic: GridNode->AddActor_Dynamic(ActorInfo, GlobalInfo);
+		break;
+	case EGClassRepNodeMapping::Spatialize_Dormancy: GridNode->AddActor_Dormancy(ActorInfo, GlobalInfo);
+		break;
+	}
+}
+
+void UGReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case EGClassRepNodeMapping::NotRouted: break;
+	case EGClassRepNodeMapping::RelevantAllConnections:
+		if (ActorInfo.StreamingLevelName == NAME_None) AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		else if (FActorRepListRefView* RepList = AlwaysRelevantStreamingLevelActors.Find(ActorInfo.StreamingLevelName))
+		{
+			if (!RepList->RemoveSlow(ActorInfo.Actor))
+				ULOG_WARNING(LogGAS, "Actor %s was not found in AlwaysRelevantStreamingLevelActors list %s", *GetNameSafe(ActorInfo.Actor),
+				             *ActorInfo.StreamingLevelName.ToString());
+		}
+		break;
+	case EGClassRepNodeMapping::Spatialize_Static: GridNode->RemoveActor_Static(ActorInfo);
+		break;
+	case EGClassRepNodeMapping::Spatialize_Dynamic: GridNode->RemoveActor_Dynamic(ActorInfo);
+		break;
+	case EGClassRepNodeMapping::Spatialize_Dormancy: GridNode->RemoveActor_Dormancy(ActorInfo);
+		break;
+	}
+}
+#pragma endregion UGReplicationGraph
+
+#pragma region UGReplicationGraphNode_AlwaysRelevant_ForConnection
+void UGReplicationGraphNode_AlwaysRelevant_ForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	const UGReplicationGraph* Graph = CastChecked<UGReplicationGraph>(GetOuter());
+
+	ReplicationActorList.Reset();
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		ReplicationActorList.ConditionalAdd(Viewer.InViewer);
+		ReplicationActorList.ConditionalAdd(Viewer.ViewTarget);
+
+		const APlayerController* PC = Cast<APlayerController>(Viewer.InViewer);
+		if (!PC) continue;
+
+		// The own player state always goes to its player, other players' are handled by the frequency limiter node
+		if (APlayerState* PlayerState = PC->PlayerState)
+		{
+			if (!bInitializedPlayerState)
+			{
+				bInitializedPlayerState = true;
+				Params.ConnectionManager.ActorInfoMap.FindOrAdd(PlayerState).ReplicationPeriodFrame = 1;
+			}
+			ReplicationActorList.ConditionalAdd(PlayerState);
+		}
+
+		if (APawn* Pawn = PC->GetPawn(); Pawn && Pawn != Viewer.ViewTarget) ReplicationActorList.ConditionalAdd(Pawn);
+	}
+
+	Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorList);
+
+	// Always relevant actors of the streaming levels this client has visible, until they are all dormant on it
+	for (int32 Index = AlwaysRelevantStreamingLevelsNeedingReplication.Num() - 1; Index >= 0; --Index)
+	{
+		const FActorRepListRefView* RepList = Graph->AlwaysRelevantStreamingLevelActors.Find(AlwaysRelevantStreamingLevelsNeedingReplication[Index]);
+		if (!RepList)
+		{
+			AlwaysRelevantStreamingLevelsNeedingReplication.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (RepList->Num() == 0) continue;
+
+		bool bAllDormant = true;
+		for (const FActorRepListType Actor : *RepList)
+		{
+			if (!Params.ConnectionManager.ActorInfoMap.FindOrAdd(Actor).bDormantOnConnection)
+			{
+				bAllDormant = false;
+				break;
+			}
+		}
+
+		if (bAllDormant) AlwaysRelevantStreamingLevelsNeedingReplication.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		else Params.OutGatheredReplicationLists.AddReplicationActorList(*RepList);
+	}
+}
+
+void UGReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityAdd(const FName LevelName, UWorld* StreamingWorld) { AlwaysRelevantStreamingLevelsNeedingReplication.AddUnique(LevelName); }
+
+void UGReplicationGraphNode_AlwaysRelevant_ForConnection::OnClientLevelVisibilityRemove(const FName LevelName) { AlwaysRelevantStreamingLevelsNeedingReplication.RemoveSwap(LevelName); }
+
+void UGReplicationGraphNode_AlwaysRelevant_ForConnection::ResetGameWorldState()
+{
+	ReplicationActorList.Reset();
+	AlwaysRelevantStreamingLevelsNeedingReplication.Empty();
+	bInitializedPlayerState = false;
+}
+
+void UGReplicationGraphNode_AlwaysRelevant_ForConnection::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+	LogActorRepList(DebugInfo, NodeName, ReplicationActorList);
+
+	for (const FName& LevelName : AlwaysRelevantStreamingLevelsNeedingReplication)
+	{
+		const UGReplicationGraph* Graph = CastChecked<const UGReplicationGraph>(GetOuter());
+		if (const FActorRepListRefView* RepList = Graph->AlwaysRelevantStreamingLevelActors.Find(LevelName))
+			LogActorRepList(DebugInfo, FString::Printf(TEXT("AlwaysRelevant StreamingLevel List: %s"), *LevelName.ToString()), *RepList);
+	}
+
+	DebugInfo.PopIndent();
+}
+#pragma endregion UGReplicationGraphNode_AlwaysRelevant_ForConnection
+
+#pragma region UGReplicationGraphNode_PlayerStateFrequencyLimiter
+UGReplicationGraphNode_PlayerStateFrequencyLimiter::UGReplicationGraphNode_PlayerStateFrequencyLimiter() { bRequiresPrepareForReplicationCall = true; }
+
+void UGReplicationGraphNode_PlayerStateFrequencyLimiter::PrepareForReplication()
+{
+	// Rebuilt every frame, which keeps the buckets compact when players leave without any bookkeeping
+	ReplicationActorLists.Reset();
+	FActorRepListRefView* CurrentList = &ReplicationActorLists.AddDefaulted_GetRef();
+
+	const AGameStateBase* GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+	if (!GameState) return;
+
+	for (APlayerState* PlayerState : GameState->PlayerArray)
+	{
+		if (!IsActorValidForReplicationGather(PlayerState)) continue;
+
+		if (CurrentList->Num() >= TargetActorsPerFrame) CurrentList = &ReplicationActorLists.AddDefaulted_GetRef();
+		CurrentList->Add(PlayerState);
+	}
+}
+
+void UGReplicationGraphNode_PlayerStateFrequencyLimiter::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	const int32 ListIndex = Params.ReplicationFrameNum % ReplicationActorLists.Num();
+	Params.OutGatheredReplicationLists.AddReplicationActorList(ReplicationActorLists[ListIndex]);
+}
+
+void UGReplicationGraphNode_PlayerStateFrequencyLimiter::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+
+	int32 Index = 0;
+	for (const FActorRepListRefView& List : ReplicationActorLists) LogActorRepList(DebugInfo, FString::Printf(TEXT("Bucket[%d]"), Index++), List);
+
+	DebugInfo.PopIndent();
+}
+#pragma endregion UGReplicationGraphNode_PlayerStateFrequencyLimiter
@@ -4,8 +4,9 @@
 #include "Engine/GameInstance.h"
 #include "Components/GameFrameworkComponentManager.h"
 #include "Component/BaseAbilitySystemComponent.h"
+#include "Engine/AssetManager.h"
 #include "Engine/World.h"
-//#include "Player/BasePlayerState.h" //@TODO: For the fname
+#include "Player/BasePlayerState.h"
 #include "GameFeatures/GameFeatureAction_WorldActionBase.h"
 
 #if WITH_EDITOR
@@ -29,6 +30,9 @@ void UGameFeatureAction_AddAbilities::OnGameFeatureActivating(FGameFeatureActiva
 	{
 		Reset(ActiveData);
 	}
+
+	// Started before the extension handlers are registered, so actors that are already around get queued behind it
+	StartPreload(Context, ActiveData);
 	Super::OnGameFeatureActivating(Context);
 }
 
@@ -165,6 +169,83 @@ void UGameFeatureAction_AddAbilities::Reset(FPerContextData& ActiveData) const
 	}
 
 	ActiveData.ComponentRequests.Empty();
+	ActiveData.PendingActors.Empty();
+
+	if (ActiveData.PreloadHandle.IsValid())
+	{
+		ActiveData.PreloadHandle->CancelHandle();
+		ActiveData.PreloadHandle.Reset();
+	}
+}
+
+TArray<FSoftObjectPath> UGameFeatureAction_AddAbilities::CollectPreloadPaths() const
+{
+	TArray<FSoftObjectPath> Paths;
+	for (const FGameFeatureAbilitiesEntry& Entry : AbilitiesList)
+	{
+		for (const FAbilityGrant& Ability : Entry.GrantedAbilities)
+		{
+			if (!Ability.AbilityType.IsNull())
+			{
+				Paths.AddUnique(Ability.AbilityType.ToSoftObjectPath());
+			}
+		}
+
+		for (const FAttributeSetGrant& Attributes : Entry.GrantedAttributes)
+		{
+			if (!Attributes.AttributeSetType.IsNull())
+			{
+				Paths.AddUnique(Attributes.AttributeSetType.ToSoftObjectPath());
+			}
+			if (!Attributes.InitializationData.IsNull())
+			{
+				Paths.AddUnique(Attributes.InitializationData.ToSoftObjectPath());
+			}
+		}
+
+		for (const TSoftObjectPtr<const UBaseAbilitySet>& SetPtr : Entry.GrantedAbilitySets)
+		{
+			if (!SetPtr.IsNull())
+			{
+				Paths.AddUnique(SetPtr.ToSoftObjectPath());
+			}
+		}
+	}
+	return Paths;
+}
+
+void UGameFeatureAction_AddAbilities::StartPreload(const FGameFeatureStateChangeContext& ChangeContext,
+                                                   FPerContextData& ActiveData)
+{
+	TArray<FSoftObjectPath> Paths = CollectPreloadPaths();
+	if (Paths.IsEmpty())
+	{
+		return;
+	}
+
+	ActiveData.PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(Paths),
+		FStreamableDelegate::CreateUObject(this, &ThisClass::HandlePreloadCompleted, ChangeContext),
+		FStreamableManager::AsyncLoadHighPriority, false, false, TEXT("GameFeatureAction_AddAbilities"));
+}
+
+void UGameFeatureAction_AddAbilities::HandlePreloadCompleted(FGameFeatureStateChangeContext ChangeContext)
+{
+	FPerContextData* ActiveData = ContextData.Find(ChangeContext);
+	if (!ActiveData)
+	{
+		return;
+	}
+
+	TArray<FPendingActorExtension> PendingActors = MoveTemp(ActiveData->PendingActors);
+	for (const FPendingActorExtension& Pending : PendingActors)
+	{
+		AActor* Actor = Pending.Actor.Get();
+		if (Actor && AbilitiesList.IsValidIndex(Pending.EntryIndex))
+		{
+			AddActorAbilities(Actor, AbilitiesList[Pending.EntryIndex], *ActiveData);
+		}
+	}
 }
 
 void UGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor,
@@ -182,13 +263,31 @@ void UGameFeatureAction_AddAbilities::HandleActorExtension(AActor* Actor,
 	if ((EventName == UGameFrameworkComponentManager::NAME_ExtensionRemoved) || (EventName ==
 		    UGameFrameworkComponentManager::NAME_ReceiverRemoved))
 	{
+		ActiveData->PendingActors.RemoveAll([Actor](const FPendingActorExtension& Pending)
+		{
+			return Pending.Actor == Actor;
+		});
 		RemoveActorAbilities(Actor, *ActiveData);
 	}
-	//@todo Implement this
-	// else if ((EventName == UGameFrameworkComponentManager::NAME_ExtensionAdded) || (EventName == ABasePlayerState::NAME_BaseAbilityReady))
-	// {
-	// 	AddActorAbilities(Actor, Entry, *ActiveData);
-	// }
+	else if ((EventName == UGameFrameworkComponentManager::NAME_ExtensionAdded) || (EventName ==
+		         ABasePlayerState::NAME_BaseAbilityReady))
+	{
+		// Never load on this path, actors that show up before the preload is done wait for it
+		if (ActiveData->PreloadHandle.IsValid() && !ActiveData->PreloadHandle->HasLoadCompleted())
+		{
+			const bool bAlreadyPending = ActiveData->PendingActors.ContainsByPredicate(
+				[Actor, EntryIndex](const FPendingActorExtension& Pending)
+				{
+					return Pending.Actor == Actor && Pending.EntryIndex == EntryIndex;
+				});
+			if (!bAlreadyPending)
+			{
+				ActiveData->PendingActors.Add({Actor, EntryIndex});
+			}
+			return;
+		}
+		AddActorAbilities(Actor, Entry, *ActiveData);
+	}
 }
 
 //  Add abilities to the actor if they don't already have them and are on the server 
@@ -229,7 +328,14 @@ void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGa
 		{
 			continue;
 		}
-		FGameplayAbilitySpec NewAbilitySpec(AbilityType.LoadSynchronous());
+		TSubclassOf<UGameplayAbility> AbilityClass = AbilityType.Get();
+		if (!AbilityClass)
+		{
+			UE_LOG(LogGameFeatures, Warning, TEXT("Ability '%s' failed to preload. It will not be granted to '%s'."),
+			       *AbilityType.ToString(), *Actor->GetPathName());
+			continue;
+		}
+		FGameplayAbilitySpec NewAbilitySpec(AbilityClass);
 		FGameplayAbilitySpecHandle AbilityHandle = AbilitySystemComponent->GiveAbility(NewAbilitySpec);
 
 		AddedExtensions.Abilities.Add(AbilityHandle);
@@ -242,16 +348,18 @@ void UGameFeatureAction_AddAbilities::AddActorAbilities(AActor* Actor, const FGa
 			continue;
 		}
 
-		TSubclassOf<UAttributeSet> SetType = Attributes.AttributeSetType.LoadSynchronous();
+		TSubclassOf<UAttributeSet> SetType = Attributes.AttributeSetType.Get();
 		if (!SetType)
 		{
+			UE_LOG(LogGameFeatures, Warning, TEXT("Attribute set '%s' failed to preload. It will not be granted to '%s'."),
+			       *Attributes.AttributeSetType.ToString(), *Actor->GetPathName());
 			continue;
 		}
 
 		UAttributeSet* NewSet = NewObject<UAttributeSet>(AbilitySystemComponent->GetOwner(), SetType);
 		if (!Attributes.InitializationData.IsNull())
 		{
-			UDataTable* InitData = Attributes.InitializationData.LoadSynchronous();
+			UDataTable* InitData = Attributes.InitializationData.Get();
 			if (InitData)
 			{
 				NewSet->InitFromMetaDataTable(InitData);
@@ -35,6 +35,23 @@ void ULyraFrontendStateComponent::BeginPlay()
 	// This delegate is on a component with the same lifetime as this one, so no need to unhook it in
 	ExperienceComponent->CallOrRegister_OnExperienceLoaded_HighPriority(
 		FOnExperienceLoaded::FDelegate::CreateUObject(this, &ThisClass::OnExperienceLoaded));
+
+	ILoadingProcessInterface::RegisterWithLoadingScreen(this);
+}
+
+void ULyraFrontendStateComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ILoadingProcessInterface::UnregisterFromLoadingScreen(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ULyraFrontendStateComponent::HideLoadingScreen()
+{
+	if (!bShouldShowLoadingScreen) return;
+
+	bShouldShowLoadingScreen = false;
+	ILoadingProcessInterface::NotifyLoadingStateChanged(this);
 }
 
 
@@ -138,13 +155,13 @@ void ULyraFrontendStateComponent::ShowPressStartScreen(FControlFlowNodeRef SubFl
 		[this, SubFlow](const EAsyncWidgetLayerState State, const UCommonActivatableWidget* Screen){
 			if (State == EAsyncWidgetLayerState::AfterPush)
 			{
-				bShouldShowLoadingScreen = false;
+				HideLoadingScreen();
 				Screen->OnDeactivated().AddWeakLambda(this, [this, SubFlow](){ SubFlow->ContinueFlow(); });
 				return;
 			}
 			if (State == EAsyncWidgetLayerState::Canceled)
 			{
-				bShouldShowLoadingScreen = false;
+				HideLoadingScreen();
 				SubFlow->ContinueFlow();
 			}
 		});
@@ -223,7 +240,7 @@ void ULyraFrontendStateComponent::FlowStep_TryShowMainScreen(FControlFlowNodeRef
 		[this, SubFlow](const EAsyncWidgetLayerState State, UCommonActivatableWidget* Screen){
 			if (State == EAsyncWidgetLayerState::AfterPush || State == EAsyncWidgetLayerState::Canceled)
 			{
-				bShouldShowLoadingScreen = false;
+				HideLoadingScreen();
 				SubFlow->ContinueFlow();
 			}
 		});
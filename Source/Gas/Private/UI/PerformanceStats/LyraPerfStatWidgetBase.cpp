@@ -13,7 +13,7 @@
 ULyraPerfStatWidgetBase::ULyraPerfStatWidgetBase(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer) {}
 
-double ULyraPerfStatWidgetBase::FetchStatValue()
+ULyraPerformanceStatSubsystem* ULyraPerfStatWidgetBase::GetStatSubsystem()
 {
 	if (CachedStatSubsystem == nullptr)
 	{
@@ -26,7 +26,25 @@ double ULyraPerfStatWidgetBase::FetchStatValue()
 		}
 	}
 
-	if (CachedStatSubsystem) { return CachedStatSubsystem->GetCachedStat(StatToDisplay); }
+	return CachedStatSubsystem;
+}
+
+double ULyraPerfStatWidgetBase::FetchStatValue()
+{
+	if (const ULyraPerformanceStatSubsystem* StatSubsystem = GetStatSubsystem()) { return StatSubsystem->GetCachedStat(StatToDisplay); }
 
 	return 0.0;
 }
+
+FLyraPerformanceStatSummary ULyraPerfStatWidgetBase::FetchStatSummary()
+{
+	if (const ULyraPerformanceStatSubsystem* StatSubsystem = GetStatSubsystem()) { return StatSubsystem->GetStatSummary(StatToDisplay); }
+
+	return FLyraPerformanceStatSummary();
+}
+
+void ULyraPerfStatWidgetBase::FetchStatHistory(TArray<double>& OutSamples, int32 MaxSamples)
+{
+	OutSamples.Reset();
+	if (const ULyraPerformanceStatSubsystem* StatSubsystem = GetStatSubsystem()) { StatSubsystem->GetStatHistory(StatToDisplay, OutSamples, MaxSamples); }
+}
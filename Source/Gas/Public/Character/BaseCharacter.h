@@ -4,6 +4,7 @@
 #include "GameplayCueInterface.h"
 #include "GameplayTagAssetInterface.h"
 #include "ModularCharacter.h"
+#include "ReplicatedAcceleration.h"
 #include "SharedRepMovement.h"
 
 #include "BaseCharacter.generated.h"
@@ -14,6 +15,7 @@ class ABasePlayerState;
 class UPawnExtensionComponent;
 class UBaseAbilitySystemComponent;
 class UHealthComponent;
+class UBaseCharacterMovementComponent;
 struct FSharedRepMovement;
 
 UCLASS(Config = Game, Meta = (ShortTooltip = "The base character pawn class used by this project."))
@@ -37,6 +39,9 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "Base|Character")
 	UBaseAbilitySystemComponent* GetBaseAbilitySystemComponent() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Base|Character")
+	UBaseCharacterMovementComponent* GetBaseCharacterMovement() const;
 	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override; // Implement IAbilitySystemInterface
 
 
@@ -123,13 +128,12 @@ private:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Base|Character", Meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<ULyraCameraComponent> CameraComponent;
 
-	/*	
-		
-	
-		UPROPERTY(Transient, ReplicatedUsing = OnRep_ReplicatedAcceleration)
-		FBaseReplicatedAcceleration ReplicatedAcceleration;*/
+	// Quantized acceleration for simulated proxies, packed in PreReplication and only marked dirty when it changes
+	UPROPERTY(Transient, ReplicatedUsing = OnRep_ReplicatedAcceleration)
+	FBaseReplicatedAcceleration ReplicatedAcceleration;
 
+	void SetReplicatedAcceleration(const FBaseReplicatedAcceleration& NewAcceleration);
 
 	UFUNCTION()
-	void OnRep_ReplicatedAcceleration() const;
+	void OnRep_ReplicatedAcceleration();
 };
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "GameFramework/CharacterMovementComponent.h"
+#include "BaseCharacterMovementComponent.generated.h"
+
+/**
+ *	Character movement component used by ABaseCharacter.
+ *	Keeps the acceleration replicated by the server on simulated proxies instead of deriving it from the velocity.
+ */
+UCLASS(Config = Game)
+class GAS_API UBaseCharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	UBaseCharacterMovementComponent(const FObjectInitializer& ObjectInitializer);
+
+	// Sets the acceleration of a simulated proxy, kept until the next replicated value
+	void SetReplicatedAcceleration(const FVector& InAcceleration);
+
+	//~UCharacterMovementComponent interface
+	virtual void SimulateMovement(float DeltaTime) override;
+	//~End of UCharacterMovementComponent interface
+
+protected:
+	// True once the server sent an acceleration for this proxy
+	UPROPERTY(Transient)
+	bool bHasReplicatedAcceleration = false;
+};
@@ -0,0 +1,36 @@
+/** Acceleration of a character packed into three bytes for simulated proxies. */
+#pragma once
+
+#include "ReplicatedAcceleration.generated.h"
+
+USTRUCT()
+struct FBaseReplicatedAcceleration
+{
+	GENERATED_BODY()
+
+	/** Quantizes Acceleration, MaxAcceleration maps to the top of the magnitude range. */
+	static FBaseReplicatedAcceleration Pack(const FVector& Acceleration, float MaxAcceleration);
+
+	FVector Unpack(float MaxAcceleration) const;
+
+	bool IsZero() const { return Magnitude == 0; }
+
+	bool operator==(const FBaseReplicatedAcceleration& Other) const
+	{
+		return Azimuth == Other.Azimuth && Elevation == Other.Elevation && Magnitude == Other.Magnitude;
+	}
+
+	bool operator!=(const FBaseReplicatedAcceleration& Other) const { return !(*this == Other); }
+
+	// Direction in the XY plane, [0, 2*pi) in 256 steps
+	UPROPERTY()
+	uint8 Azimuth = 0;
+
+	// Angle above the XY plane, [-pi/2, pi/2] in 255 steps
+	UPROPERTY()
+	int8 Elevation = 0;
+
+	// Length of the acceleration, [0, MaxAcceleration] in 256 steps
+	UPROPERTY()
+	uint8 Magnitude = 0;
+};
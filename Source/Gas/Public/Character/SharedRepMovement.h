@@ -1,6 +1,7 @@
 /** The type we use to send FastShared movement updates. */
 #pragma once
 
+#include "Character/ReplicatedAcceleration.h"
 #include "SharedRepMovement.generated.h"
 
 USTRUCT()
@@ -10,8 +11,13 @@ struct FSharedRepMovement
 	FSharedRepMovement();
 
 	bool FillForCharacter(const ACharacter* Character);
+	/** True when Other is within the Gas.SharedRepMovement.*Tolerance cvars of this update, i.e. not worth resending. */
 	bool Equals(const FSharedRepMovement& Other, ACharacter* Character) const;
 
+	/** Picks the quantization of RepMovement from the Gas.SharedRepMovement.* cvars and the per update bit budget. */
+	void ApplyQuantizationLevels();
+	int64 GetSerializedBits() const;
+
 	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
 
 	UPROPERTY(Transient)
@@ -28,6 +34,9 @@ struct FSharedRepMovement
 
 	UPROPERTY(Transient)
 	bool bIsCrouched = false;
+
+	UPROPERTY(Transient)
+	FBaseReplicatedAcceleration RepAcceleration;
 };
 
 
@@ -0,0 +1,124 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "GReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_GridSpatialization2D;
+
+/** How actors of a class are routed into the graph */
+UENUM()
+enum class EGClassRepNodeMapping : uint32
+{
+	NotRouted,              // Doesn't map to any node. Used for special case actors handled by special case nodes (player states)
+	RelevantAllConnections, // Routes to the always relevant node (game state, other always relevant infos)
+
+	// Spatialized routes into the grid node
+
+	Spatialize_Static,   // Actors that never move after spawning
+	Spatialize_Dynamic,  // Actors that move frequently (characters)
+	Spatialize_Dormancy, // Actors that are spatialized until they go dormant on a connection (pickups)
+};
+
+/**
+ * Replication graph of the project.
+ * Characters go into a spatial grid and use the fast shared movement path, the game state and other always relevant
+ * actors are replicated to every connection, player states are spread over several frames and actors with a dormant
+ * default (or listed in DormancyRoutedActorClasses) stop replicating on a connection once they go dormant on it.
+ *
+ * Created for the game net driver unless Gas.RepGraph.Enable is 0.
+ */
+UCLASS(Transient, Config=Engine)
+class GAS_API UGReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	UGReplicationGraph();
+
+	//~UReplicationGraph interface
+	virtual void ResetGameWorldState() override;
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* RepGraphConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	//~End of UReplicationGraph interface
+
+	/** Actor classes routed through the dormancy path whatever their default dormancy is, e.g. pickups */
+	UPROPERTY(Config)
+	TArray<TSoftClassPtr<AActor>> DormancyRoutedActorClasses;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_GridSpatialization2D> GridNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	/** Always relevant actors that live in streaming levels, only sent to connections that have the level visible */
+	TMap<FName, FActorRepListRefView> AlwaysRelevantStreamingLevelActors;
+
+private:
+	EGClassRepNodeMapping GetClassNodeMapping(UClass* Class) const;
+	void RegisterClassRepNodeMapping(UClass* Class);
+	void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, bool bSpatialize) const;
+	EGClassRepNodeMapping GetMappingPolicy(UClass* Class);
+
+	static bool IsSpatialized(const EGClassRepNodeMapping Mapping) { return Mapping >= EGClassRepNodeMapping::Spatialize_Static; }
+
+	TClassMap<EGClassRepNodeMapping> ClassRepNodePolicies;
+};
+
+/** Per connection: the viewer, its view target, its pawn and its own player state, plus always relevant streaming level actors */
+UCLASS()
+class GAS_API UGReplicationGraphNode_AlwaysRelevant_ForConnection : public UReplicationGraphNode_AlwaysRelevant_ForConnection
+{
+	GENERATED_BODY()
+
+public:
+	//~UReplicationGraphNode interface
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& Actor) override {}
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override {}
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+	//~End of UReplicationGraphNode interface
+
+	void OnClientLevelVisibilityAdd(FName LevelName, UWorld* StreamingWorld);
+	void OnClientLevelVisibilityRemove(FName LevelName);
+
+	void ResetGameWorldState();
+
+private:
+	TArray<FName, TInlineAllocator<64>> AlwaysRelevantStreamingLevelsNeedingReplication;
+
+	bool bInitializedPlayerState = false;
+};
+
+/** Spreads the player states over several frames instead of sending all of them to every connection every frame */
+UCLASS()
+class GAS_API UGReplicationGraphNode_PlayerStateFrequencyLimiter : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	UGReplicationGraphNode_PlayerStateFrequencyLimiter();
+
+	//~UReplicationGraphNode interface
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& Actor) override {}
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override {}
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+	virtual void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+	//~End of UReplicationGraphNode interface
+
+	/** How many player states are sent to a connection per frame */
+	int32 TargetActorsPerFrame = 2;
+
+private:
+	TArray<FActorRepListRefView> ReplicationActorLists;
+};
@@ -14,6 +14,7 @@ class UInputAction;
 class UAttributeSet;
 class UDataTable;
 struct FComponentRequestHandle;
+struct FStreamableHandle;
 class UBaseAbilitySet;
 
 USTRUCT(BlueprintType)
@@ -98,10 +99,22 @@ private:
 		TArray<FGrantedHandlesData> AbilitySetHandles;
 	};
 
+	struct FPendingActorExtension
+	{
+		TWeakObjectPtr<AActor> Actor;
+		int32 EntryIndex = INDEX_NONE;
+	};
+
 	struct FPerContextData
 	{
 		TMap<AActor*, FActorExtensions> ActiveExtensions;
 		TArray<TSharedPtr<FComponentRequestHandle>> ComponentRequests;
+
+		// Async load of every class and asset referenced by AbilitiesList, started on activation
+		TSharedPtr<FStreamableHandle> PreloadHandle;
+
+		// Actors that became ready before the preload finished, granted when it does
+		TArray<FPendingActorExtension> PendingActors;
 	};
 
 	TMap<FGameFeatureStateChangeContext, FPerContextData> ContextData;
@@ -112,6 +125,9 @@ private:
 	//~ End UGameFeatureAction_WorldActionBase interface
 
 	void Reset(FPerContextData& ActiveData) const;
+	TArray<FSoftObjectPath> CollectPreloadPaths() const;
+	void StartPreload(const FGameFeatureStateChangeContext& ChangeContext, FPerContextData& ActiveData);
+	void HandlePreloadCompleted(FGameFeatureStateChangeContext ChangeContext);
 	void HandleActorExtension(AActor* Actor, FName EventName, int32 EntryIndex,
 	                          FGameFeatureStateChangeContext ChangeContext);
 	void AddActorAbilities(AActor* Actor, const FGameFeatureAbilitiesEntry& AbilitiesEntry,
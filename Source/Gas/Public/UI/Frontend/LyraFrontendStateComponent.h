@@ -32,6 +32,7 @@ public:
 
 	//~UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	//~ILoadingProcessInterface interface
 	virtual bool ShouldShowLoadingScreen(FString& OutReason) const override;
@@ -50,6 +51,7 @@ private:
 	void ShowPressStartScreen(FControlFlowNodeRef Shared);
 	void FlowStep_TryJoinRequestedSession(FControlFlowNodeRef SubFlow);
 	void FlowStep_TryShowMainScreen(FControlFlowNodeRef SubFlow);
+	void HideLoadingScreen();
 
 	bool bShouldShowLoadingScreen = true;
 
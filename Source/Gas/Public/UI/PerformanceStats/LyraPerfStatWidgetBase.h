@@ -3,11 +3,10 @@
 #pragma once
 
 #include "CommonUserWidget.h"
+#include "Performance/LyraPerformanceStatTypes.h"
 
 #include "LyraPerfStatWidgetBase.generated.h"
 
-enum class ELyraDisplayablePerformanceStat : uint8;
-
 class ULyraPerformanceStatSubsystem;
 class UObject;
 struct FFrame;
@@ -37,7 +36,17 @@ public:
 	UFUNCTION(BlueprintPure)
 	double FetchStatValue();
 
+	// Rolling min/avg/max/percentiles of this stat, for graph and text widgets
+	UFUNCTION(BlueprintPure)
+	FLyraPerformanceStatSummary FetchStatSummary();
+
+	// The last MaxSamples values of this stat, oldest first, for graph widgets
+	UFUNCTION(BlueprintCallable)
+	void FetchStatHistory(TArray<double>& OutSamples, int32 MaxSamples = 240);
+
 protected:
+	ULyraPerformanceStatSubsystem* GetStatSubsystem();
+
 	// Cached subsystem pointer
 	UPROPERTY(Transient)
 	TObjectPtr<ULyraPerformanceStatSubsystem> CachedStatSubsystem;